@@ -0,0 +1,59 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <Atomic.hpp>
+
+#include "Benchmark.hpp"
+
+using namespace yt;
+
+BENCHMARK(atomic_load_relaxed) {
+    Atomic<usize> value(0);
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(value.load(MemoryOrder::Relaxed));
+    }
+}
+
+BENCHMARK(atomic_fetch_add_relaxed) {
+    Atomic<usize> value(0);
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(value.fetch_add(1, MemoryOrder::Relaxed));
+    }
+}
+
+BENCHMARK(atomic_fetch_add_seq_cst) {
+    Atomic<usize> value(0);
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(value.fetch_add(1));
+    }
+}
+
+BENCHMARK(atomic_compare_exchange) {
+    Atomic<usize> value(0);
+    for (usize i = 0; i < iterations; i++) {
+        usize expected = i;
+        DO_NOT_OPTIMIZE_AWAY(value.compare_exchange(expected, i + 1, MemoryOrder::AcqRel, MemoryOrder::Relaxed));
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <BTreeMap.hpp>
+
+#include "Benchmark.hpp"
+#include "MapInputs.hpp"
+
+using namespace yt;
+using namespace yt::Bench;
+
+/*
+ * BTreeMap<u32, u32> with 64k entries. The std::map versions (suffix _host) are in
+ * BTreeMapHostBench.cpp, the keys come from MapInputs.hpp so both sides see the same data.
+ */
+
+using Map = BTreeMap<u32, u32>;
+
+static const Map& filled_map() {
+    static Map map = [] {
+        Map result;
+        for (usize i = 0; i < map_size; i++) {
+            result.set(map_key(i), static_cast<u32>(i));
+        }
+        return result;
+    }();
+    return map;
+}
+
+BENCHMARK(btree_map_lookup_hit_64k) {
+    const Map& map = filled_map();
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(map.get(map_key(i)).value());
+    }
+}
+
+BENCHMARK(btree_map_lookup_miss_64k) {
+    const Map& map = filled_map();
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(map.contains(map_missing_key(i)));
+    }
+}
+
+/* ns/op is per inserted entry, the map is cleared every map_size inserts */
+BENCHMARK(btree_map_insert_random_64k) {
+    Map map;
+    for (usize i = 0; i < iterations; i++) {
+        if ((i & (map_size - 1)) == 0) {
+            map.clear();
+        }
+        map.set(map_key(i), static_cast<u32>(i));
+    }
+    DO_NOT_OPTIMIZE_AWAY(map.size());
+}
+
+BENCHMARK(btree_map_insert_sequential_64k) {
+    Map map;
+    for (usize i = 0; i < iterations; i++) {
+        if ((i & (map_size - 1)) == 0) {
+            map.clear();
+        }
+        map.set(static_cast<u32>(i & (map_size - 1)), static_cast<u32>(i));
+    }
+    DO_NOT_OPTIMIZE_AWAY(map.size());
+}
+
+/* ns/op is per scan of map_scan_length entries starting at a scattered key */
+BENCHMARK(btree_map_range_scan_1k) {
+    const Map& map = filled_map();
+    for (usize i = 0; i < iterations; i++) {
+        u32 from = map_key(i);
+        u32 sum = 0;
+        for (auto entry : map.range(from, from + 2 * map_scan_length)) {
+            sum += entry.value;
+        }
+        DO_NOT_OPTIMIZE_AWAY(sum);
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <map>
+
+#include "Benchmark.hpp"
+#include "MapInputs.hpp"
+
+using namespace yt::Bench;
+
+/*
+ * The std::map counterparts of BTreeMapBench.cpp. Like SortHostBench.cpp this file must not include
+ * LibYT container headers.
+ */
+
+using Map = std::map<u32, u32>;
+
+static const Map& filled_map() {
+    static Map map = [] {
+        Map result;
+        for (usize i = 0; i < map_size; i++) {
+            result.emplace(map_key(i), static_cast<u32>(i));
+        }
+        return result;
+    }();
+    return map;
+}
+
+BENCHMARK(btree_map_lookup_hit_64k_host) {
+    const Map& map = filled_map();
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(map.find(map_key(i))->second);
+    }
+}
+
+BENCHMARK(btree_map_lookup_miss_64k_host) {
+    const Map& map = filled_map();
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(map.find(map_missing_key(i)) != map.end());
+    }
+}
+
+BENCHMARK(btree_map_insert_random_64k_host) {
+    Map map;
+    for (usize i = 0; i < iterations; i++) {
+        if ((i & (map_size - 1)) == 0) {
+            map.clear();
+        }
+        map.insert_or_assign(map_key(i), static_cast<u32>(i));
+    }
+    DO_NOT_OPTIMIZE_AWAY(map.size());
+}
+
+BENCHMARK(btree_map_insert_sequential_64k_host) {
+    Map map;
+    for (usize i = 0; i < iterations; i++) {
+        if ((i & (map_size - 1)) == 0) {
+            map.clear();
+        }
+        map.insert_or_assign(static_cast<u32>(i & (map_size - 1)), static_cast<u32>(i));
+    }
+    DO_NOT_OPTIMIZE_AWAY(map.size());
+}
+
+BENCHMARK(btree_map_range_scan_1k_host) {
+    const Map& map = filled_map();
+    for (usize i = 0; i < iterations; i++) {
+        u32 from = map_key(i);
+        u32 sum = 0;
+        auto end = map.lower_bound(from + 2 * map_scan_length);
+        for (auto it = map.lower_bound(from); it != end; ++it) {
+            sum += it->second;
+        }
+        DO_NOT_OPTIMIZE_AWAY(sum);
+    }
+}
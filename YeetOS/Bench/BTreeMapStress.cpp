@@ -0,0 +1,195 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <BTreeMap.hpp>
+
+#include "BTreeMapStressReference.hpp"
+
+using namespace yt;
+
+/*
+ * Randomized correctness check for BTreeMap. Every set(), remove() and lookup is mirrored on a
+ * std::map and the results have to agree. The key space changes between small and large so leaves
+ * and inner nodes keep splitting, borrowing and merging, each block of steps first grows the map and
+ * then shrinks it, sometimes down to empty. check_invariants() walks the leaf links and node fill
+ * counts regularly, and the map is now and then rebuilt with from_sorted() and mutated further.
+ */
+
+using Map = BTreeMap<u32, u32>;
+
+struct Entry {
+    u32 key;
+    u32 value;
+};
+
+static constexpr u32 max_key_space = 1 << 16;
+static constexpr usize block_steps = 40'000;
+
+static constexpr u32 key_spaces[] = { 64, 1024, max_key_space };
+
+static u32 s_keys[max_key_space];
+static u32 s_values[max_key_space];
+static Entry s_entries[max_key_space];
+
+static u32 s_random = 0x2545f491;
+
+static u32 next_random() {
+    s_random ^= s_random << 13;
+    s_random ^= s_random >> 17;
+    s_random ^= s_random << 5;
+    return s_random;
+}
+
+static bool report(const char* what, usize step) {
+    fprintf(stderr, "btree-map-stress: %s at step %zu\n", what, step);
+    return false;
+}
+
+static bool compare_range(const Map& map, u32 from, u32 to) {
+    usize count = Reference::range(from, to, s_keys, s_values, max_key_space);
+    usize i = 0;
+
+    for (auto entry : map.range(from, to)) {
+        if (i == count || entry.key != s_keys[i] || entry.value != s_values[i]) {
+            return false;
+        }
+        i++;
+    }
+
+    return i == count;
+}
+
+static bool compare_all(const Map& map) {
+    return map.size() == Reference::size() && compare_range(map, 0, max_key_space) && map.check_invariants();
+}
+
+/* builds a new map from the reference contents */
+static Map rebuild() {
+    usize count = Reference::range(0, max_key_space, s_keys, s_values, max_key_space);
+    for (usize i = 0; i < count; i++) {
+        s_entries[i] = { s_keys[i], s_values[i] };
+    }
+    return Map::from_sorted(Slice<Entry>(s_entries, count));
+}
+
+static bool check_from_sorted() {
+    for (usize count = 0; count < 3000; count += count < 300 ? 1 : 37) {
+        Reference::clear();
+        for (usize i = 0; i < count; i++) {
+            s_entries[i] = { static_cast<u32>(i * 3), static_cast<u32>(i) };
+            Reference::set(static_cast<u32>(i * 3), static_cast<u32>(i));
+        }
+
+        Map map = Map::from_sorted(Slice<Entry>(s_entries, count));
+        if (!compare_all(map)) {
+            return report("from_sorted() mismatch", count);
+        }
+    }
+
+    Reference::clear();
+    return true;
+}
+
+static bool run(usize steps) {
+    Map map;
+
+    for (usize step = 0; step < steps; step++) {
+        usize block = step / block_steps;
+        u32 key_space = key_spaces[block % (sizeof(key_spaces) / sizeof(key_spaces[0]))];
+        bool growing = step % block_steps < block_steps / 2;
+
+        u32 key = next_random() % key_space;
+        u32 value = next_random();
+        u32 operation = next_random() % 100;
+
+        if (operation < (growing ? 65u : 25u)) {
+            if (map.set(key, value) != Reference::set(key, value)) {
+                return report("set() mismatch", step);
+            }
+        } else if (operation < 90) {
+            if (map.remove(key) != Reference::remove(key)) {
+                return report("remove() mismatch", step);
+            }
+        } else if (operation < 97) {
+            u32 expected;
+            bool present = Reference::get(key, &expected);
+            auto result = map.get(key);
+            if (result.has_value() != present || (present && result.value() != expected)) {
+                return report("get() mismatch", step);
+            }
+        } else {
+            if (!compare_range(map, key, key + next_random() % 256)) {
+                return report("range() mismatch", step);
+            }
+        }
+
+        if (step % 997 == 0 && !map.check_invariants()) {
+            return report("broken invariants", step);
+        }
+
+        if (step % 24'989 == 0) {
+            map = rebuild();
+            if (!compare_all(map)) {
+                return report("mismatch after from_sorted()", step);
+            }
+        }
+
+        /* every other block ends by removing everything, so the root collapses all the way */
+        if (step % block_steps == block_steps - 1) {
+            if (block % 2 == 1) {
+                usize count = Reference::range(0, max_key_space, s_keys, s_values, max_key_space);
+                for (usize i = 0; i < count; i++) {
+                    if (!map.remove(s_keys[i]) || !Reference::remove(s_keys[i])) {
+                        return report("remove() while draining failed", step);
+                    }
+                }
+            }
+
+            if (!compare_all(map)) {
+                return report("mismatch at the end of a block", step);
+            }
+        }
+    }
+
+    return compare_all(map) || report("final mismatch", steps);
+}
+
+int main(int argc, char** argv) {
+    usize steps = 1'000'000;
+    if (argc > 1) {
+        steps = strtoull(argv[1], nullptr, 10);
+    }
+
+    if (!check_from_sorted() || !run(steps)) {
+        fprintf(stderr, "btree-map-stress: FAILED\n");
+        return 1;
+    }
+
+    printf("btree-map-stress: %zu steps passed\n", steps);
+    return 0;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <map>
+
+#include "BTreeMapStressReference.hpp"
+
+namespace Reference {
+
+static std::map<u32, u32> s_map;
+
+void clear() {
+    s_map.clear();
+}
+
+bool set(u32 key, u32 value) {
+    return s_map.insert_or_assign(key, value).second;
+}
+
+bool remove(u32 key) {
+    return s_map.erase(key) != 0;
+}
+
+bool get(u32 key, u32* value) {
+    auto it = s_map.find(key);
+    if (it == s_map.end()) {
+        return false;
+    }
+    *value = it->second;
+    return true;
+}
+
+usize size() {
+    return s_map.size();
+}
+
+usize range(u32 from, u32 to, u32* keys, u32* values, usize max) {
+    usize count = 0;
+    for (auto it = s_map.lower_bound(from); it != s_map.end() && it->first < to && count < max; ++it, count++) {
+        keys[count] = it->first;
+        values[count] = it->second;
+    }
+    return count;
+}
+
+} /* namespace Reference */
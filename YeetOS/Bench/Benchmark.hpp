@@ -0,0 +1,93 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Types.hpp>
+#include <Platform.hpp>
+
+namespace yt::Bench {
+
+/**
+ * A benchmark body runs the measured operation `iterations` times.
+ * Results that the compiler could otherwise discard should be passed to DO_NOT_OPTIMIZE_AWAY().
+ */
+using BenchmarkFunction = void (*)(usize iterations);
+
+/**
+ * A statically registered benchmark, normally created through the BENCHMARK() macro.
+ * Benchmarks form an intrusive list in registration order so no allocation happens before main().
+ */
+class Benchmark {
+    NOT_COPYABLE(Benchmark);
+    NOT_MOVABLE(Benchmark);
+
+public:
+    Benchmark(const char* name, BenchmarkFunction function) noexcept : m_name(name), m_function(function) {
+        if (s_last) {
+            s_last->m_next = this;
+        } else {
+            s_first = this;
+        }
+        s_last = this;
+    }
+
+    const char* name() const noexcept {
+        return m_name;
+    }
+
+    void run(usize iterations) const noexcept {
+        m_function(iterations);
+    }
+
+    const Benchmark* next() const noexcept {
+        return m_next;
+    }
+
+    static const Benchmark* first() noexcept {
+        return s_first;
+    }
+
+private:
+    const char* m_name;
+    BenchmarkFunction m_function;
+    Benchmark* m_next = nullptr;
+
+    static inline Benchmark* s_first = nullptr;
+    static inline Benchmark* s_last = nullptr;
+};
+
+/**
+ * Looks up `name` in the host libc, skipping the Libc/ definitions linked into the benchmark.
+ * Used to compare the kernel's string functions against the host ones. Returns nullptr if not found.
+ */
+void* host_libc_symbol(const char* name);
+
+} /* namespace yt::Bench */
+
+#define BENCHMARK(name)                                                                                                \
+    static void CONCAT(bench_, name)(usize iterations);                                                                \
+    static yt::Bench::Benchmark CONCAT(bench_entry_, name)(#name, CONCAT(bench_, name));                               \
+    static void CONCAT(bench_, name)(UNUSED usize iterations)
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <Checked.hpp>
+
+#include "Benchmark.hpp"
+
+using namespace yt;
+
+BENCHMARK(checked_add_u32) {
+    Checked<u32> value(0u);
+    for (usize i = 0; i < iterations; i++) {
+        value.add(static_cast<u32>(i & 1));
+        DO_NOT_OPTIMIZE_AWAY(value.has_overflow());
+    }
+}
+
+BENCHMARK(checked_mul_u64) {
+    for (usize i = 0; i < iterations; i++) {
+        Checked<u64> value(static_cast<u64>(i));
+        value.mul(3);
+        DO_NOT_OPTIMIZE_AWAY(value.has_overflow());
+    }
+}
+
+BENCHMARK(checked_operator_plus_i32) {
+    Checked<i32> a(1);
+    for (usize i = 0; i < iterations; i++) {
+        Checked<i32> b(static_cast<i32>(i & 0xFFFF));
+        auto c = a + b;
+        DO_NOT_OPTIMIZE_AWAY(c.has_overflow());
+    }
+}
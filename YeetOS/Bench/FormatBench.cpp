@@ -0,0 +1,85 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <stdio.h>
+
+#include <Format.hpp>
+#include <IntegerFormatting.hpp>
+
+#include "Benchmark.hpp"
+
+using namespace yt;
+
+BENCHMARK(format_unsigned_decimal_u32) {
+    char buffer[max_integer_digits];
+    for (usize i = 0; i < iterations; i++) {
+        u32 value = static_cast<u32>(i * 2654435761u);
+        DO_NOT_OPTIMIZE_AWAY(format_unsigned(buffer + sizeof(buffer), value));
+        DO_NOT_OPTIMIZE_AWAY(buffer);
+    }
+}
+
+BENCHMARK(format_unsigned_decimal_u64) {
+    char buffer[max_integer_digits];
+    for (usize i = 0; i < iterations; i++) {
+        u64 value = i * 0x9E3779B97F4A7C15ull;
+        DO_NOT_OPTIMIZE_AWAY(format_unsigned(buffer + sizeof(buffer), value));
+        DO_NOT_OPTIMIZE_AWAY(buffer);
+    }
+}
+
+BENCHMARK(format_unsigned_hex_u64) {
+    char buffer[max_integer_digits];
+    for (usize i = 0; i < iterations; i++) {
+        u64 value = i * 0x9E3779B97F4A7C15ull;
+        DO_NOT_OPTIMIZE_AWAY(format_unsigned(buffer + sizeof(buffer), value, 16));
+        DO_NOT_OPTIMIZE_AWAY(buffer);
+    }
+}
+
+static void discard(void*, StringView chunk) {
+    DO_NOT_OPTIMIZE_AWAY(chunk.characters());
+}
+
+BENCHMARK(format_to_mixed_arguments) {
+    for (usize i = 0; i < iterations; i++) {
+        FormatBuilder builder(discard, nullptr);
+        format_to(builder, "page {:#010x} order {} owner {} refs {}", i * 4096, i & 7, "kernel", -static_cast<isize>(i));
+    }
+}
+
+BENCHMARK(format_to_mixed_arguments_snprintf_host) {
+    char buffer[128];
+    for (usize i = 0; i < iterations; i++) {
+        snprintf(buffer,
+                 sizeof(buffer),
+                 "page %#010zx order %zu owner %s refs %zd",
+                 i * 4096,
+                 i & 7,
+                 "kernel",
+                 -static_cast<isize>(i));
+        DO_NOT_OPTIMIZE_AWAY(buffer);
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <Function.hpp>
+
+#include "Benchmark.hpp"
+
+using namespace yt;
+
+/*
+ * The call benchmarks go through a NEVER_INLINE runner and hide the callable's address from the
+ * optimizer, so every variant ends up as a real indirect call. The difference to function_pointer_call
+ * is what the wrapper adds on top.
+ */
+
+using Callback = u64(u64);
+
+NEVER_INLINE static u64 add_one(u64 value) {
+    return value + 1;
+}
+
+/* a lambda that still fits Function's inline storage */
+struct SmallCallable {
+    u64 offset;
+
+    u64 operator()(u64 value) const {
+        return value + offset;
+    }
+};
+
+/* a lambda that is too large for the inline storage and ends up on the heap */
+struct LargeCallable {
+    u64 offsets[8];
+
+    u64 operator()(u64 value) const {
+        return value + offsets[value & 7];
+    }
+};
+
+NEVER_INLINE static void run_pointer(Callback* callback, usize iterations) {
+    u64 value = 0;
+    for (usize i = 0; i < iterations; i++) {
+        value = callback(value);
+    }
+    DO_NOT_OPTIMIZE_AWAY(value);
+}
+
+NEVER_INLINE static void run_function_ref(FunctionRef<Callback> callback, usize iterations) {
+    u64 value = 0;
+    for (usize i = 0; i < iterations; i++) {
+        value = callback(value);
+    }
+    DO_NOT_OPTIMIZE_AWAY(value);
+}
+
+NEVER_INLINE static void run_function(const Function<Callback>& callback, usize iterations) {
+    u64 value = 0;
+    for (usize i = 0; i < iterations; i++) {
+        value = callback(value);
+    }
+    DO_NOT_OPTIMIZE_AWAY(value);
+}
+
+BENCHMARK(function_pointer_call) {
+    Callback* callback = add_one;
+    DO_NOT_OPTIMIZE_AWAY(callback);
+    run_pointer(callback, iterations);
+}
+
+BENCHMARK(function_ref_call_pointer) {
+    FunctionRef<Callback> callback(add_one);
+    DO_NOT_OPTIMIZE_AWAY(&callback);
+    run_function_ref(callback, iterations);
+}
+
+BENCHMARK(function_ref_call_lambda) {
+    SmallCallable lambda { 1 };
+    FunctionRef<Callback> callback(lambda);
+    DO_NOT_OPTIMIZE_AWAY(&callback);
+    run_function_ref(callback, iterations);
+}
+
+BENCHMARK(function_call_pointer) {
+    Function<Callback> callback(&add_one);
+    DO_NOT_OPTIMIZE_AWAY(&callback);
+    run_function(callback, iterations);
+}
+
+BENCHMARK(function_call_inline) {
+    Function<Callback> callback(SmallCallable { 1 });
+    DO_NOT_OPTIMIZE_AWAY(&callback);
+    run_function(callback, iterations);
+}
+
+BENCHMARK(function_call_heap) {
+    Function<Callback> callback(LargeCallable { { 1, 1, 1, 1, 1, 1, 1, 1 } });
+    DO_NOT_OPTIMIZE_AWAY(&callback);
+    run_function(callback, iterations);
+}
+
+BENCHMARK(function_construct_inline) {
+    for (usize i = 0; i < iterations; i++) {
+        Function<Callback> callback(SmallCallable { i });
+        DO_NOT_OPTIMIZE_AWAY(&callback);
+    }
+}
+
+BENCHMARK(function_construct_heap) {
+    for (usize i = 0; i < iterations; i++) {
+        Function<Callback> callback(LargeCallable { { i } });
+        DO_NOT_OPTIMIZE_AWAY(&callback);
+    }
+}
+
+BENCHMARK(function_move_inline) {
+    Function<Callback> a(SmallCallable { 1 });
+    Function<Callback> b;
+    for (usize i = 0; i < iterations; i++) {
+        b = move(a);
+        a = move(b);
+        DO_NOT_OPTIMIZE_AWAY(&a);
+    }
+}
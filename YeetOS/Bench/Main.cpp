@@ -0,0 +1,275 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <Types.hpp>
+#include <Utility.hpp>
+
+#include "Benchmark.hpp"
+
+namespace yt::Bench {
+
+enum class Format {
+    Text,
+    Csv,
+    Json,
+};
+
+struct Config {
+    const char* filter = nullptr;
+    const char* output_path = nullptr;
+    Format format = Format::Text;
+    u64 min_time_ns = 50'000'000;
+    usize repetitions = 5;
+};
+
+struct Result {
+    const char* name;
+    usize iterations;
+    double min_ns;
+    double median_ns;
+    double mean_ns;
+};
+
+static constexpr usize max_repetitions = 64;
+
+static u64 now_ns() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<u64>(ts.tv_sec) * 1'000'000'000 + static_cast<u64>(ts.tv_nsec);
+}
+
+static u64 time_run(const Benchmark& benchmark, usize iterations) {
+    u64 start = now_ns();
+    benchmark.run(iterations);
+    return now_ns() - start;
+}
+
+/**
+ * Doubles the iteration count until a single run takes at least `min_time_ns`.
+ * The runs done here double as warmup for caches and branch predictors.
+ */
+static usize calibrate(const Benchmark& benchmark, u64 min_time_ns) {
+    usize iterations = 1;
+
+    while (true) {
+        u64 elapsed = time_run(benchmark, iterations);
+
+        if (elapsed >= min_time_ns || iterations >= (usize(1) << 40)) {
+            return iterations;
+        }
+
+        if (elapsed < min_time_ns / 100) {
+            iterations *= 10;
+        } else {
+            iterations *= 2;
+        }
+    }
+}
+
+static Result run_benchmark(const Benchmark& benchmark, const Config& config) {
+    double samples[max_repetitions];
+    usize iterations = calibrate(benchmark, config.min_time_ns);
+
+    for (usize i = 0; i < config.repetitions; i++) {
+        samples[i] = static_cast<double>(time_run(benchmark, iterations)) / static_cast<double>(iterations);
+    }
+
+    /* insertion sort, repetitions is tiny */
+    for (usize i = 1; i < config.repetitions; i++) {
+        for (usize j = i; j > 0 && samples[j] < samples[j - 1]; j--) {
+            swap(samples[j], samples[j - 1]);
+        }
+    }
+
+    double sum = 0;
+    for (usize i = 0; i < config.repetitions; i++) {
+        sum += samples[i];
+    }
+
+    return Result {
+        .name = benchmark.name(),
+        .iterations = iterations,
+        .min_ns = samples[0],
+        .median_ns = samples[config.repetitions / 2],
+        .mean_ns = sum / static_cast<double>(config.repetitions),
+    };
+}
+
+static void print_header(FILE* out, Format format) {
+    switch (format) {
+    case Format::Text:
+        fprintf(out, "%-40s %14s %12s %12s %12s\n", "benchmark", "iterations", "min ns/op", "median ns/op", "mean ns/op");
+        break;
+    case Format::Csv:
+        fprintf(out, "name,iterations,min_ns,median_ns,mean_ns\n");
+        break;
+    case Format::Json:
+        fprintf(out, "[\n");
+        break;
+    }
+}
+
+static void print_result(FILE* out, Format format, const Result& result, bool first) {
+    switch (format) {
+    case Format::Text:
+        fprintf(out,
+                "%-40s %14zu %12.3f %12.3f %12.3f\n",
+                result.name,
+                result.iterations,
+                result.min_ns,
+                result.median_ns,
+                result.mean_ns);
+        break;
+    case Format::Csv:
+        fprintf(out,
+                "%s,%zu,%.3f,%.3f,%.3f\n",
+                result.name,
+                result.iterations,
+                result.min_ns,
+                result.median_ns,
+                result.mean_ns);
+        break;
+    case Format::Json:
+        fprintf(out,
+                "%s  {\"name\": \"%s\", \"iterations\": %zu, \"min_ns\": %.3f, \"median_ns\": %.3f, \"mean_ns\": %.3f}",
+                first ? "" : ",\n",
+                result.name,
+                result.iterations,
+                result.min_ns,
+                result.median_ns,
+                result.mean_ns);
+        break;
+    }
+    fflush(out);
+}
+
+static void print_footer(FILE* out, Format format) {
+    if (format == Format::Json) {
+        fprintf(out, "\n]\n");
+    }
+}
+
+static const char* option_value(const char* arg, const char* option) {
+    usize length = strlen(option);
+    if (strncmp(arg, option, length) == 0 && arg[length] == '=') {
+        return arg + length + 1;
+    }
+    return nullptr;
+}
+
+static void usage(const char* program) {
+    fprintf(stderr,
+            "usage: %s [--filter=SUBSTRING] [--format=text|csv|json] [--out=PATH] [--min-time-ms=N] "
+            "[--repetitions=N] [--list]\n",
+            program);
+}
+
+} /* namespace yt::Bench */
+
+using namespace yt::Bench;
+
+int main(int argc, char** argv) {
+    Config config;
+    bool list_only = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value;
+
+        if ((value = option_value(arg, "--filter"))) {
+            config.filter = value;
+        } else if ((value = option_value(arg, "--out"))) {
+            config.output_path = value;
+        } else if ((value = option_value(arg, "--min-time-ms"))) {
+            config.min_time_ns = strtoull(value, nullptr, 10) * 1'000'000;
+        } else if ((value = option_value(arg, "--repetitions"))) {
+            config.repetitions = strtoull(value, nullptr, 10);
+        } else if ((value = option_value(arg, "--format"))) {
+            if (strcmp(value, "text") == 0) {
+                config.format = Format::Text;
+            } else if (strcmp(value, "csv") == 0) {
+                config.format = Format::Csv;
+            } else if (strcmp(value, "json") == 0) {
+                config.format = Format::Json;
+            } else {
+                usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(arg, "--list") == 0) {
+            list_only = true;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (config.repetitions == 0 || config.repetitions > max_repetitions) {
+        fprintf(stderr, "repetitions must be between 1 and %zu\n", max_repetitions);
+        return 1;
+    }
+
+    FILE* out = stdout;
+    if (config.output_path) {
+        out = fopen(config.output_path, "w");
+        if (!out) {
+            perror(config.output_path);
+            return 1;
+        }
+    }
+
+    if (!list_only) {
+        print_header(out, config.format);
+    }
+
+    bool first = true;
+    for (auto* benchmark = Benchmark::first(); benchmark; benchmark = benchmark->next()) {
+        if (config.filter && !strstr(benchmark->name(), config.filter)) {
+            continue;
+        }
+
+        if (list_only) {
+            fprintf(out, "%s\n", benchmark->name());
+            continue;
+        }
+
+        print_result(out, config.format, run_benchmark(*benchmark, config), first);
+        first = false;
+    }
+
+    if (!list_only) {
+        print_footer(out, config.format);
+    }
+
+    if (out != stdout) {
+        fclose(out);
+    }
+
+    return 0;
+}
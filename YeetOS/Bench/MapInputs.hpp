@@ -0,0 +1,56 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Types.hpp>
+#include <Platform.hpp>
+
+namespace yt::Bench {
+
+/*
+ * Keys for BTreeMapBench.cpp and BTreeMapHostBench.cpp. The map holds the even numbers below
+ * 2 * map_size, so odd keys are guaranteed misses and a key range [k, k + 2n) holds n entries.
+ */
+
+inline constexpr usize map_size = 64 * 1024;
+inline constexpr usize map_scan_length = 1024;
+
+static_assert((map_size & (map_size - 1)) == 0, "map_size must be a power of two");
+
+/* visits every index below map_size exactly once, in a scattered order */
+ALWAYS_INLINE constexpr u32 map_index(usize i) {
+    return static_cast<u32>((i * 0x9e3779b1u) & (map_size - 1));
+}
+
+ALWAYS_INLINE constexpr u32 map_key(usize i) {
+    return map_index(i) * 2;
+}
+
+ALWAYS_INLINE constexpr u32 map_missing_key(usize i) {
+    return map_index(i) * 2 + 1;
+}
+
+} /* namespace yt::Bench */
@@ -0,0 +1,130 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <MpmcQueue.hpp>
+
+#include "Benchmark.hpp"
+
+using namespace yt;
+
+/*
+ * The threaded benchmarks move `iterations` elements through one queue with P producer and C consumer
+ * threads (mpmc_queue_<P>p<C>c), so ns/op is the time per element for the whole group. Comparing the
+ * rows shows how the shared enqueue/dequeue counters scale with contention.
+ */
+
+static constexpr usize queue_capacity = 1024;
+static constexpr usize batch_size = 64;
+
+using Queue = MpmcQueue<u64, queue_capacity>;
+
+static Queue s_queue;
+
+BENCHMARK(mpmc_queue_push_pop) {
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(s_queue.try_push(i));
+        DO_NOT_OPTIMIZE_AWAY(s_queue.try_pop());
+    }
+}
+
+BENCHMARK(mpmc_queue_bulk_64) {
+    u64 values[batch_size] = {};
+    for (usize i = 0; i < iterations; i += batch_size) {
+        s_queue.try_push_bulk(Slice<const u64>(values, batch_size));
+        DO_NOT_OPTIMIZE_AWAY(s_queue.try_pop_bulk(Slice<u64>(values, batch_size)));
+    }
+}
+
+/* splits `total` into `parts` shares that differ by at most one */
+static usize share(usize total, usize parts, usize index) {
+    return total / parts + (index < total % parts ? 1 : 0);
+}
+
+static void* produce(void* argument) {
+    usize count = reinterpret_cast<usize>(argument);
+    for (usize i = 0; i < count;) {
+        if (s_queue.try_push(i)) {
+            i++;
+        } else {
+            sched_yield();
+        }
+    }
+    return nullptr;
+}
+
+static void* consume(void* argument) {
+    usize count = reinterpret_cast<usize>(argument);
+    for (usize i = 0; i < count;) {
+        if (auto value = s_queue.try_pop(); value.has_value()) {
+            DO_NOT_OPTIMIZE_AWAY(value.value());
+            i++;
+        } else {
+            sched_yield();
+        }
+    }
+    return nullptr;
+}
+
+template<usize Producers, usize Consumers>
+static void run_threaded(usize iterations) {
+    pthread_t threads[Producers + Consumers];
+    for (usize i = 0; i < Consumers; i++) {
+        pthread_create(&threads[i], nullptr, consume, reinterpret_cast<void*>(share(iterations, Consumers, i)));
+    }
+    for (usize i = 0; i < Producers; i++) {
+        pthread_create(&threads[Consumers + i], nullptr, produce,
+                       reinterpret_cast<void*>(share(iterations, Producers, i)));
+    }
+    for (pthread_t thread : threads) {
+        pthread_join(thread, nullptr);
+    }
+}
+
+BENCHMARK(mpmc_queue_1p1c) {
+    run_threaded<1, 1>(iterations);
+}
+
+BENCHMARK(mpmc_queue_2p2c) {
+    run_threaded<2, 2>(iterations);
+}
+
+BENCHMARK(mpmc_queue_4p4c) {
+    run_threaded<4, 4>(iterations);
+}
+
+BENCHMARK(mpmc_queue_8p8c) {
+    run_threaded<8, 8>(iterations);
+}
+
+BENCHMARK(mpmc_queue_1p4c) {
+    run_threaded<1, 4>(iterations);
+}
+
+BENCHMARK(mpmc_queue_4p1c) {
+    run_threaded<4, 1>(iterations);
+}
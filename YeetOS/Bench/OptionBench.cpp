@@ -0,0 +1,65 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <Option.hpp>
+#include <OwnPtr.hpp>
+
+#include "Benchmark.hpp"
+
+using namespace yt;
+
+BENCHMARK(option_int_construct_value) {
+    for (usize i = 0; i < iterations; i++) {
+        Option<usize> opt(i);
+        DO_NOT_OPTIMIZE_AWAY(opt.value());
+    }
+}
+
+BENCHMARK(option_int_assign_clear) {
+    Option<usize> opt;
+    for (usize i = 0; i < iterations; i++) {
+        opt = Option<usize>(i);
+        DO_NOT_OPTIMIZE_AWAY(opt.has_value());
+        opt.clear();
+        DO_NOT_OPTIMIZE_AWAY(opt.has_value());
+    }
+}
+
+BENCHMARK(option_pointer_has_value) {
+    int dummy = 0;
+    Option<int*> opt(&dummy);
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(opt);
+        DO_NOT_OPTIMIZE_AWAY(opt.has_value());
+    }
+}
+
+BENCHMARK(option_ref_release) {
+    int dummy = 0;
+    for (usize i = 0; i < iterations; i++) {
+        Option<int&> opt(dummy);
+        DO_NOT_OPTIMIZE_AWAY(&opt.release());
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <Slice.hpp>
+
+#include "Benchmark.hpp"
+
+using namespace yt;
+
+static constexpr usize buffer_size = 4096;
+
+static u8 s_source[buffer_size];
+static u8 s_destination[buffer_size];
+
+BENCHMARK(slice_index_sum) {
+    Slice<u8> slice(s_source);
+    for (usize i = 0; i < iterations; i++) {
+        usize sum = 0;
+        for (usize j = 0; j < slice.size(); j++) {
+            sum += slice[j];
+        }
+        DO_NOT_OPTIMIZE_AWAY(sum);
+    }
+}
+
+BENCHMARK(slice_copy_from_4k) {
+    Slice<u8> source(s_source);
+    Slice<u8> destination(s_destination);
+    for (usize i = 0; i < iterations; i++) {
+        destination.copy_from(source);
+        DO_NOT_OPTIMIZE_AWAY(s_destination);
+    }
+}
+
+BENCHMARK(slice_fill_4k) {
+    Slice<u8> destination(s_destination);
+    for (usize i = 0; i < iterations; i++) {
+        destination.fill(static_cast<u8>(i));
+        DO_NOT_OPTIMIZE_AWAY(s_destination);
+    }
+}
+
+BENCHMARK(slice_equals_4k) {
+    Slice<u8> a(s_source);
+    Slice<u8> b(s_destination);
+    b.copy_from(a);
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(a.equals(b));
+    }
+}
+
+BENCHMARK(slice_find_4k) {
+    Slice<u8> slice(s_source);
+    slice.fill(0);
+    slice[buffer_size - 1] = 1;
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(slice.find(1).value());
+    }
+}
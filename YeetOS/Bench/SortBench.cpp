@@ -0,0 +1,120 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <string.h>
+
+#include <Sort.hpp>
+
+#include "Benchmark.hpp"
+#include "SortInputs.hpp"
+
+using namespace yt;
+using namespace yt::Bench;
+
+/*
+ * Each benchmark copies a prepared input and sorts it, so ns/op is the time for one whole sort.
+ * The host std::sort and std::stable_sort versions (suffix _host) are in SortHostBench.cpp because
+ * the standard headers cannot be included next to LibYT's New.hpp. radix_sort has no std counterpart
+ * and is meant to be read against sort_*_host.
+ */
+
+static u32 s_input[sort_large_size];
+static u32 s_values[sort_large_size];
+static u32 s_scratch[sort_large_size];
+
+static void prepare(SortPattern pattern, usize count) {
+    fill_sort_input(s_input, count, pattern);
+}
+
+static void run_sort(usize iterations, SortPattern pattern, usize count) {
+    prepare(pattern, count);
+    for (usize i = 0; i < iterations; i++) {
+        memcpy(s_values, s_input, count * sizeof(u32));
+        sort(s_values, s_values + count);
+        DO_NOT_OPTIMIZE_AWAY(s_values);
+    }
+}
+
+static void run_stable_sort(usize iterations, SortPattern pattern, usize count) {
+    prepare(pattern, count);
+    for (usize i = 0; i < iterations; i++) {
+        memcpy(s_values, s_input, count * sizeof(u32));
+        stable_sort(s_values, s_values + count);
+        DO_NOT_OPTIMIZE_AWAY(s_values);
+    }
+}
+
+static void run_radix_sort(usize iterations, SortPattern pattern, usize count) {
+    prepare(pattern, count);
+    for (usize i = 0; i < iterations; i++) {
+        memcpy(s_values, s_input, count * sizeof(u32));
+        radix_sort(Slice<u32>(s_values, count), Slice<u32>(s_scratch, count));
+        DO_NOT_OPTIMIZE_AWAY(s_values);
+    }
+}
+
+BENCHMARK(sort_random_4k) {
+    run_sort(iterations, SortPattern::Random, sort_small_size);
+}
+
+BENCHMARK(sort_sorted_4k) {
+    run_sort(iterations, SortPattern::Sorted, sort_small_size);
+}
+
+BENCHMARK(sort_reversed_4k) {
+    run_sort(iterations, SortPattern::Reversed, sort_small_size);
+}
+
+BENCHMARK(sort_few_unique_4k) {
+    run_sort(iterations, SortPattern::FewUnique, sort_small_size);
+}
+
+BENCHMARK(sort_random_64k) {
+    run_sort(iterations, SortPattern::Random, sort_large_size);
+}
+
+BENCHMARK(stable_sort_random_4k) {
+    run_stable_sort(iterations, SortPattern::Random, sort_small_size);
+}
+
+BENCHMARK(stable_sort_sorted_4k) {
+    run_stable_sort(iterations, SortPattern::Sorted, sort_small_size);
+}
+
+BENCHMARK(stable_sort_few_unique_4k) {
+    run_stable_sort(iterations, SortPattern::FewUnique, sort_small_size);
+}
+
+BENCHMARK(stable_sort_random_64k) {
+    run_stable_sort(iterations, SortPattern::Random, sort_large_size);
+}
+
+BENCHMARK(radix_sort_random_4k) {
+    run_radix_sort(iterations, SortPattern::Random, sort_small_size);
+}
+
+BENCHMARK(radix_sort_random_64k) {
+    run_radix_sort(iterations, SortPattern::Random, sort_large_size);
+}
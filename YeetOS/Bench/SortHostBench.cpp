@@ -0,0 +1,94 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "Benchmark.hpp"
+#include "SortInputs.hpp"
+
+using namespace yt::Bench;
+
+/*
+ * The host counterparts of SortBench.cpp. This file must not include any LibYT container header,
+ * their New.hpp conflicts with <new> which the standard headers pull in.
+ */
+
+static u32 s_input[sort_large_size];
+static u32 s_values[sort_large_size];
+
+static void run_sort(usize iterations, SortPattern pattern, usize count) {
+    fill_sort_input(s_input, count, pattern);
+    for (usize i = 0; i < iterations; i++) {
+        std::memcpy(s_values, s_input, count * sizeof(u32));
+        std::sort(s_values, s_values + count);
+        DO_NOT_OPTIMIZE_AWAY(s_values);
+    }
+}
+
+static void run_stable_sort(usize iterations, SortPattern pattern, usize count) {
+    fill_sort_input(s_input, count, pattern);
+    for (usize i = 0; i < iterations; i++) {
+        std::memcpy(s_values, s_input, count * sizeof(u32));
+        std::stable_sort(s_values, s_values + count);
+        DO_NOT_OPTIMIZE_AWAY(s_values);
+    }
+}
+
+BENCHMARK(sort_random_4k_host) {
+    run_sort(iterations, SortPattern::Random, sort_small_size);
+}
+
+BENCHMARK(sort_sorted_4k_host) {
+    run_sort(iterations, SortPattern::Sorted, sort_small_size);
+}
+
+BENCHMARK(sort_reversed_4k_host) {
+    run_sort(iterations, SortPattern::Reversed, sort_small_size);
+}
+
+BENCHMARK(sort_few_unique_4k_host) {
+    run_sort(iterations, SortPattern::FewUnique, sort_small_size);
+}
+
+BENCHMARK(sort_random_64k_host) {
+    run_sort(iterations, SortPattern::Random, sort_large_size);
+}
+
+BENCHMARK(stable_sort_random_4k_host) {
+    run_stable_sort(iterations, SortPattern::Random, sort_small_size);
+}
+
+BENCHMARK(stable_sort_sorted_4k_host) {
+    run_stable_sort(iterations, SortPattern::Sorted, sort_small_size);
+}
+
+BENCHMARK(stable_sort_few_unique_4k_host) {
+    run_stable_sort(iterations, SortPattern::FewUnique, sort_small_size);
+}
+
+BENCHMARK(stable_sort_random_64k_host) {
+    run_stable_sort(iterations, SortPattern::Random, sort_large_size);
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Types.hpp>
+#include <Platform.hpp>
+
+namespace yt::Bench {
+
+/*
+ * The inputs for SortBench.cpp and SortHostBench.cpp. They are generated the same way on both
+ * sides so the LibYT and the host numbers are directly comparable.
+ */
+
+enum class SortPattern {
+    Random,
+    Sorted,
+    Reversed,
+    FewUnique,
+};
+
+inline constexpr usize sort_small_size = 4 * 1024;
+inline constexpr usize sort_large_size = 64 * 1024;
+
+inline void fill_sort_input(u32* values, usize count, SortPattern pattern) {
+    u32 state = 0x9e3779b9;
+
+    for (usize i = 0; i < count; i++) {
+        /* xorshift32, deterministic so every run sorts the same data */
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+
+        switch (pattern) {
+            case SortPattern::Random:
+                values[i] = state;
+                break;
+            case SortPattern::Sorted:
+                values[i] = static_cast<u32>(i);
+                break;
+            case SortPattern::Reversed:
+                values[i] = static_cast<u32>(count - i);
+                break;
+            case SortPattern::FewUnique:
+                values[i] = state % 16;
+                break;
+        }
+    }
+}
+
+} /* namespace yt::Bench */
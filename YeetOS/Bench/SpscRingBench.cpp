@@ -0,0 +1,140 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <SpscRing.hpp>
+
+#include "Benchmark.hpp"
+
+using namespace yt;
+
+/*
+ * Single-threaded numbers show the cost of the index bookkeeping, the threaded ones the cost of moving
+ * the cache lines between the producer and the consumer core. The correctness check under
+ * ThreadSanitizer lives in SpscRingStress.cpp.
+ */
+
+static constexpr usize ring_capacity = 1024;
+static constexpr usize batch_size = 64;
+
+using Ring = SpscRing<u64, ring_capacity>;
+
+BENCHMARK(spsc_ring_push_pop) {
+    static Ring ring;
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(ring.try_push(i));
+        DO_NOT_OPTIMIZE_AWAY(ring.try_pop());
+    }
+}
+
+BENCHMARK(spsc_ring_fill_drain) {
+    static Ring ring;
+    for (usize i = 0; i < iterations; i += ring_capacity) {
+        for (usize j = 0; j < ring_capacity; j++) {
+            DO_NOT_OPTIMIZE_AWAY(ring.try_push(j));
+        }
+        for (usize j = 0; j < ring_capacity; j++) {
+            DO_NOT_OPTIMIZE_AWAY(ring.try_pop());
+        }
+    }
+}
+
+BENCHMARK(spsc_ring_batch_64) {
+    static Ring ring;
+    u64 values[batch_size] = {};
+    for (usize i = 0; i < iterations; i += batch_size) {
+        ring.push_batch(Slice<const u64>(values, batch_size));
+        DO_NOT_OPTIMIZE_AWAY(ring.pop_batch(Slice<u64>(values, batch_size)));
+    }
+}
+
+struct ThreadedRun {
+    Ring ring;
+    usize count;
+};
+
+static void* consume(void* argument) {
+    auto* run = static_cast<ThreadedRun*>(argument);
+    for (usize received = 0; received < run->count;) {
+        if (auto value = run->ring.try_pop(); value.has_value()) {
+            DO_NOT_OPTIMIZE_AWAY(value.value());
+            received++;
+        } else {
+            sched_yield();
+        }
+    }
+    return nullptr;
+}
+
+static void* consume_batch(void* argument) {
+    auto* run = static_cast<ThreadedRun*>(argument);
+    u64 values[batch_size];
+    for (usize received = 0; received < run->count;) {
+        usize popped = run->ring.pop_batch(Slice<u64>(values, batch_size));
+        if (popped == 0) {
+            sched_yield();
+        }
+        DO_NOT_OPTIMIZE_AWAY(values);
+        received += popped;
+    }
+    return nullptr;
+}
+
+/* one element per iteration crosses from this thread to a second one */
+BENCHMARK(spsc_ring_threaded) {
+    static ThreadedRun run;
+    run.count = iterations;
+
+    pthread_t consumer;
+    pthread_create(&consumer, nullptr, consume, &run);
+    for (usize i = 0; i < iterations;) {
+        if (run.ring.try_push(i)) {
+            i++;
+        } else {
+            sched_yield();
+        }
+    }
+    pthread_join(consumer, nullptr);
+}
+
+BENCHMARK(spsc_ring_threaded_batch_64) {
+    static ThreadedRun run;
+    run.count = iterations;
+
+    pthread_t consumer;
+    pthread_create(&consumer, nullptr, consume_batch, &run);
+    u64 values[batch_size] = {};
+    for (usize sent = 0; sent < iterations;) {
+        usize count = iterations - sent < batch_size ? iterations - sent : batch_size;
+        usize pushed = run.ring.push_batch(Slice<const u64>(values, count));
+        if (pushed == 0) {
+            sched_yield();
+        }
+        sent += pushed;
+    }
+    pthread_join(consumer, nullptr);
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <SpscRing.hpp>
+
+using namespace yt;
+
+/*
+ * Threaded correctness check for SpscRing, meant to be run under ThreadSanitizer (YEETOS_BENCH_TSAN).
+ * The producer mixes single pushes with batches of varying size, the consumer does the same with pops,
+ * and every element has to arrive exactly once, in order and not torn. The ring is kept small so both
+ * sides hit the full and empty paths and the index wrap-around all the time.
+ */
+
+struct Element {
+    u64 sequence;
+    u64 check;
+};
+
+static constexpr usize ring_capacity = 16;
+static constexpr usize max_batch = 7;
+
+static usize s_count = 4'000'000;
+static SpscRing<Element, ring_capacity> s_ring;
+
+static Element make_element(u64 sequence) {
+    return { sequence, ~sequence * 0x9e3779b97f4a7c15 };
+}
+
+static void* produce(void*) {
+    Element batch[max_batch];
+    u64 next = 0;
+
+    while (next < s_count) {
+        usize count = next % (max_batch + 1);
+        if (count > s_count - next) {
+            count = s_count - next;
+        }
+
+        usize pushed = 0;
+        if (count == 0) {
+            pushed = s_ring.try_push(make_element(next)) ? 1 : 0;
+        } else {
+            for (usize i = 0; i < count; i++) {
+                batch[i] = make_element(next + i);
+            }
+            pushed = s_ring.push_batch(Slice<const Element>(batch, count));
+        }
+
+        if (pushed == 0) {
+            sched_yield();
+        }
+        next += pushed;
+    }
+    return nullptr;
+}
+
+static bool check_element(const Element& element, u64 expected) {
+    Element reference = make_element(expected);
+    if (element.sequence != reference.sequence || element.check != reference.check) {
+        fprintf(stderr, "spsc-stress: expected %llu, got %llu (check %llx)\n", static_cast<unsigned long long>(expected),
+                static_cast<unsigned long long>(element.sequence), static_cast<unsigned long long>(element.check));
+        return false;
+    }
+    return true;
+}
+
+static void* consume(void*) {
+    Element batch[max_batch];
+    u64 expected = 0;
+
+    while (expected < s_count) {
+        usize count = (expected * 3) % (max_batch + 1);
+
+        usize popped = 0;
+        if (count == 0) {
+            if (auto element = s_ring.try_pop(); element.has_value()) {
+                if (!check_element(element.value(), expected)) {
+                    return reinterpret_cast<void*>(1);
+                }
+                popped = 1;
+            }
+        } else {
+            popped = s_ring.pop_batch(Slice<Element>(batch, count));
+            for (usize i = 0; i < popped; i++) {
+                if (!check_element(batch[i], expected + i)) {
+                    return reinterpret_cast<void*>(1);
+                }
+            }
+        }
+
+        if (popped == 0) {
+            sched_yield();
+        }
+        expected += popped;
+    }
+    return nullptr;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        s_count = strtoull(argv[1], nullptr, 10);
+    }
+
+    pthread_t producer;
+    pthread_t consumer;
+    pthread_create(&producer, nullptr, produce, nullptr);
+    pthread_create(&consumer, nullptr, consume, nullptr);
+
+    void* result = nullptr;
+    pthread_join(producer, nullptr);
+    pthread_join(consumer, &result);
+
+    if (result != nullptr || !s_ring.is_empty()) {
+        fprintf(stderr, "spsc-stress: FAILED\n");
+        return 1;
+    }
+
+    printf("spsc-stress: %zu elements passed\n", s_count);
+    return 0;
+}
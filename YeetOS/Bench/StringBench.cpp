@@ -0,0 +1,224 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <string.h>
+
+#include <Types.hpp>
+
+#include "Benchmark.hpp"
+
+using namespace yt::Bench;
+
+/*
+ * Each function from Libc/string.cpp is measured next to the host libc version (suffix _host)
+ * at a few lengths, and once with a misaligned pointer.
+ */
+
+static constexpr usize buffer_size = 64 * 1024;
+
+static char s_source[buffer_size + 64];
+static char s_destination[buffer_size + 64];
+
+/* volatile so the compiler cannot inline the call for a known size */
+static volatile usize s_size;
+
+template<typename Function>
+static Function host(const char* name) {
+    return reinterpret_cast<Function>(host_libc_symbol(name));
+}
+
+/* fills the source with a repeating alphabet so scans have to look at every byte */
+static char* prepare_string(usize size, usize misalign) {
+    for (usize i = 0; i < size; i++) {
+        s_source[misalign + i] = static_cast<char>('a' + i % 26);
+    }
+    s_source[misalign + size] = '\0';
+    return s_source + misalign;
+}
+
+template<typename Function>
+static void run_copy(Function function, usize iterations, usize size, usize misalign) {
+    s_size = size;
+    for (usize i = 0; i < iterations; i++) {
+        function(s_destination + misalign, s_source, s_size);
+        DO_NOT_OPTIMIZE_AWAY(s_destination);
+    }
+}
+
+template<typename Function>
+static void run_move_forward(Function function, usize iterations, usize size, usize misalign) {
+    s_size = size;
+    for (usize i = 0; i < iterations; i++) {
+        function(s_destination, s_destination + 8 + misalign, s_size);
+        DO_NOT_OPTIMIZE_AWAY(s_destination);
+    }
+}
+
+template<typename Function>
+static void run_move_backward(Function function, usize iterations, usize size, usize misalign) {
+    s_size = size;
+    for (usize i = 0; i < iterations; i++) {
+        function(s_destination + 8 + misalign, s_destination, s_size);
+        DO_NOT_OPTIMIZE_AWAY(s_destination);
+    }
+}
+
+template<typename Function>
+static void run_fill(Function function, usize iterations, usize size, usize misalign) {
+    s_size = size;
+    for (usize i = 0; i < iterations; i++) {
+        function(s_destination + misalign, static_cast<int>(i), s_size);
+        DO_NOT_OPTIMIZE_AWAY(s_destination);
+    }
+}
+
+template<typename Function>
+static void run_compare(Function function, usize iterations, usize size, usize misalign) {
+    const char* string = prepare_string(size, misalign);
+    memcpy(s_destination, string, size);
+    s_size = size;
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(function(string, s_destination, s_size));
+    }
+}
+
+template<typename Function>
+static void run_find(Function function, usize iterations, usize size, usize misalign) {
+    memset(s_source, 'a', size + misalign);
+    s_source[misalign + size - 1] = 'b';
+    s_size = size;
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(function(s_source + misalign, 'b', s_size));
+    }
+}
+
+template<typename Function>
+static void run_find_reverse(Function function, usize iterations, usize size, usize misalign) {
+    memset(s_source, 'a', size + misalign);
+    s_source[misalign] = 'b';
+    s_size = size;
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(function(s_source + misalign, 'b', s_size));
+    }
+}
+
+template<typename Function>
+static void run_length(Function function, usize iterations, usize size, usize misalign) {
+    const char* string = prepare_string(size, misalign);
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(string);
+        DO_NOT_OPTIMIZE_AWAY(function(string));
+    }
+}
+
+template<typename Function>
+static void run_bounded_length(Function function, usize iterations, usize size, usize misalign) {
+    const char* string = prepare_string(size, misalign);
+    s_size = 2 * size;
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(function(string, s_size));
+    }
+}
+
+template<typename Function>
+static void run_char_search(Function function, usize iterations, usize size, usize misalign) {
+    const char* string = prepare_string(size, misalign);
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(string);
+        DO_NOT_OPTIMIZE_AWAY(function(string, '!'));
+    }
+}
+
+template<typename Function>
+static void run_string_copy(Function function, usize iterations, usize size, usize misalign) {
+    const char* string = prepare_string(size, misalign);
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(function(s_destination, string));
+    }
+}
+
+template<typename Function>
+static void run_bounded_string_copy(Function function, usize iterations, usize size, usize misalign) {
+    const char* string = prepare_string(size, misalign);
+    s_size = sizeof(s_destination);
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(function(s_destination, string, s_size));
+    }
+}
+
+template<typename Function>
+static void run_substring_search(Function function, usize iterations, usize size, usize misalign) {
+    char* string = prepare_string(size, misalign);
+    memcpy(string + size - 6, "needle", 6);
+    for (usize i = 0; i < iterations; i++) {
+        DO_NOT_OPTIMIZE_AWAY(string);
+        DO_NOT_OPTIMIZE_AWAY(function(string, "needle"));
+    }
+}
+
+#define STRING_BENCHMARK(function, suffix, runner, size, misalign)                                                     \
+    BENCHMARK(function##_##suffix) {                                                                                   \
+        runner(function, iterations, size, misalign);                                                                  \
+    }                                                                                                                  \
+    BENCHMARK(function##_##suffix##_host) {                                                                            \
+        static auto host_function = host<decltype(&function)>(#function);                                              \
+        runner(host_function, iterations, size, misalign);                                                             \
+    }
+
+#define STRING_BENCHMARKS(function, runner)                                                                            \
+    STRING_BENCHMARK(function, 16, runner, 16, 0)                                                                      \
+    STRING_BENCHMARK(function, 256, runner, 256, 0)                                                                    \
+    STRING_BENCHMARK(function, 4k, runner, 4096, 0)                                                                    \
+    STRING_BENCHMARK(function, 4k_misaligned, runner, 4096, 3)
+
+STRING_BENCHMARKS(memcpy, run_copy)
+STRING_BENCHMARK(memcpy, 64k, run_copy, buffer_size, 0)
+STRING_BENCHMARKS(memset, run_fill)
+
+STRING_BENCHMARK(memmove, 256_forward, run_move_forward, 256, 0)
+STRING_BENCHMARK(memmove, 4k_forward, run_move_forward, 4096, 0)
+STRING_BENCHMARK(memmove, 256_backward, run_move_backward, 256, 0)
+STRING_BENCHMARK(memmove, 4k_backward, run_move_backward, 4096, 0)
+STRING_BENCHMARK(memmove, 4k_backward_misaligned, run_move_backward, 4096, 3)
+
+STRING_BENCHMARKS(memcmp, run_compare)
+STRING_BENCHMARKS(memchr, run_find)
+STRING_BENCHMARKS(memrchr, run_find_reverse)
+
+STRING_BENCHMARKS(strlen, run_length)
+STRING_BENCHMARKS(strnlen, run_bounded_length)
+STRING_BENCHMARKS(strchr, run_char_search)
+STRING_BENCHMARKS(strrchr, run_char_search)
+STRING_BENCHMARKS(strcpy, run_string_copy)
+STRING_BENCHMARKS(strstr, run_substring_search)
+
+/* no host comparison, glibc only has strlcpy since 2.38 */
+BENCHMARK(strlcpy_256) {
+    run_bounded_string_copy(strlcpy, iterations, 256, 0);
+}
+
+BENCHMARK(strlcpy_4k) {
+    run_bounded_string_copy(strlcpy, iterations, 4096, 0);
+}
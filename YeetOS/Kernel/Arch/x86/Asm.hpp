@@ -54,32 +54,45 @@ ALWAYS_INLINE u16 inw(u16 port)
 
 ALWAYS_INLINE void stosb(void* buf, u8 val, u32 count)
 {
-    asm("rep stosb" ::"a"(val), "c"(count), "D"(buf));
+    asm volatile("rep stosb" : "+D"(buf), "+c"(count) : "a"(val) : "memory");
 }
 
 ALWAYS_INLINE void stosw(void* buf, u16 val, u32 count)
 {
-    asm("rep stosw" ::"a"(val), "c"(count), "D"(buf));
+    asm volatile("rep stosw" : "+D"(buf), "+c"(count) : "a"(val) : "memory");
 }
 
 ALWAYS_INLINE void stosd(void* buf, u32 val, u32 count)
 {
-    asm("rep stosl" ::"a"(val), "c"(count), "D"(buf));
+    asm volatile("rep stosl" : "+D"(buf), "+c"(count) : "a"(val) : "memory");
 }
 
 ALWAYS_INLINE void movsb(void* dest, const void* src, u32 count)
 {
-    asm("rep movsb" ::"D"(dest), "S"(src), "c"(count));
+    asm volatile("rep movsb" : "+D"(dest), "+S"(src), "+c"(count) : : "memory");
 }
 
 ALWAYS_INLINE void movsw(void* dest, const void* src, u32 count)
 {
-    asm("rep movsw" ::"D"(dest), "S"(src), "c"(count));
+    asm volatile("rep movsw" : "+D"(dest), "+S"(src), "+c"(count) : : "memory");
 }
 
 ALWAYS_INLINE void movsd(void* dest, const void* src, u32 count)
 {
-    asm("rep movsl" ::"D"(dest), "S"(src), "c"(count));
+    asm volatile("rep movsl" : "+D"(dest), "+S"(src), "+c"(count) : : "memory");
+}
+
+/**
+ * Copies `count` dwords from high to low addresses, `dest` and `src` point to the last dword.
+ */
+ALWAYS_INLINE void movsd_backward(void* dest, const void* src, u32 count)
+{
+    asm volatile("std \n\t"
+                 "rep movsl \n\t"
+                 "cld \n\t"
+                 : "+D"(dest), "+S"(src), "+c"(count)
+                 :
+                 : "memory");
 }
 
 ALWAYS_INLINE void invlpg(FlatPtr addr)
@@ -123,3 +136,37 @@ ALWAYS_INLINE u32 eflags()
     asm volatile("pushfd \n\t" "popl %%eax \n\t" : "=a"(flags));
     return flags;
 }
+
+struct CpuidResult {
+    u32 eax;
+    u32 ebx;
+    u32 ecx;
+    u32 edx;
+};
+
+ALWAYS_INLINE CpuidResult cpuid(u32 leaf, u32 subleaf = 0)
+{
+    CpuidResult res;
+    asm volatile("cpuid" : "=a"(res.eax), "=b"(res.ebx), "=c"(res.ecx), "=d"(res.edx) : "a"(leaf), "c"(subleaf));
+    return res;
+}
+
+/**
+ * Checks whether the ID flag in EFLAGS can be toggled, which means the cpuid instruction is available.
+ */
+ALWAYS_INLINE bool has_cpuid()
+{
+    u32 before, after;
+    asm volatile("pushfl \n\t"
+                 "pushfl \n\t"
+                 "popl %0 \n\t"
+                 "movl %0, %1 \n\t"
+                 "xorl $0x200000, %0 \n\t"
+                 "pushl %0 \n\t"
+                 "popfl \n\t"
+                 "pushfl \n\t"
+                 "popl %0 \n\t"
+                 "popfl \n\t"
+                 : "=&r"(after), "=&r"(before));
+    return ((before ^ after) & 0x200000) != 0;
+}
@@ -24,6 +24,7 @@
  */
 
 #include <Types.hpp>
+#include <StringView.hpp>
 
 #include <Kernel/Arch/x86/Asm.hpp>
 
@@ -38,6 +39,9 @@
 #define MODEM_STAT 6
 #define SCRATCH    7
 
+/* size of the 16550A transmit FIFO */
+#define FIFO_SIZE 16
+
 namespace Kernel::DebugLog {
 
 static inline bool is_transmit_empty()
@@ -73,12 +77,7 @@ void putchar(char c)
 
 isize print(const char* msg)
 {
-    isize res = 0;
-    for (; *msg; msg++) {
-        res++;
-        putchar(*msg);
-    }
-    return res;
+    return print(StringView(msg));
 }
 
 isize println(const char* msg)
@@ -88,4 +87,35 @@ isize println(const char* msg)
     return res + 1;
 }
 
+/**
+ * With the FIFO enabled an empty transmit register means the whole FIFO is free,
+ * so wait once per FIFO_SIZE characters instead of once per character.
+ */
+isize print(StringView msg)
+{
+    const char* chars = msg.characters();
+    usize remaining = msg.length();
+
+    while (remaining) {
+        while (!is_transmit_empty()) {}
+
+        usize chunk = remaining < FIFO_SIZE ? remaining : FIFO_SIZE;
+        for (usize i = 0; i < chunk; i++) {
+            outb(COM1 + DATA, chars[i]);
+        }
+
+        chars += chunk;
+        remaining -= chunk;
+    }
+
+    return msg.length();
+}
+
+isize println(StringView msg)
+{
+    isize res = print(msg);
+    putchar('\n');
+    return res + 1;
+}
+
 }
\ No newline at end of file
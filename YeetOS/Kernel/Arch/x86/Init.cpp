@@ -28,6 +28,7 @@
 #include <Kernel/Kernel.hpp>
 #include <Kernel/DebugLog.hpp>
 #include <Kernel/Arch/x86/Init.hpp>
+#include <Kernel/Arch/x86/Processor.hpp>
 
 namespace Kernel::Arch {
 
@@ -56,6 +57,11 @@ static void register_eh_frame() noexcept
  */
 extern "C" void arch_early_init(FlatPtr multiboot_struct, u32 multiboot_check)
 {
+    /* must come first, memcpy() and memset() choose their implementation based on it */
+    Processor::detect_features();
+
+    Processor::initialize_segments();
+
     DebugLog::initialize();
     DebugLog::println("DebugLog initialized...");
 
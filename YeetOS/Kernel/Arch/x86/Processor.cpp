@@ -0,0 +1,123 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <Types.hpp>
+
+#include <Kernel/Arch/x86/Asm.hpp>
+#include <Kernel/Arch/x86/Processor.hpp>
+
+#define CPUID_EXTENDED_FEATURES 7
+
+#define CPUID_7_EBX_ERMS (1 << 9)
+#define CPUID_7_EDX_FSRM (1 << 4)
+
+#define GDT_KERNEL_CODE 0x08
+#define GDT_KERNEL_DATA 0x10
+#define GDT_THREAD_DATA 0x18
+
+#define GDT_ACCESS_CODE 0x9A /* present, ring 0, executable, readable */
+#define GDT_ACCESS_DATA 0x92 /* present, ring 0, writable */
+#define GDT_FLAGS_32BIT 0xC  /* 4KiB granularity, 32-bit */
+
+namespace Kernel {
+
+namespace {
+
+struct GdtEntry {
+    u16 limit_low;
+    u16 base_low;
+    u8 base_middle;
+    u8 access;
+    u8 limit_high_and_flags;
+    u8 base_high;
+} PACKED;
+
+struct GdtPointer {
+    u16 limit;
+    u32 base;
+} PACKED;
+
+constexpr GdtEntry make_gdt_entry(u32 base, u32 limit, u8 access, u8 flags)
+{
+    return GdtEntry {
+        .limit_low = static_cast<u16>(limit & 0xFFFF),
+        .base_low = static_cast<u16>(base & 0xFFFF),
+        .base_middle = static_cast<u8>((base >> 16) & 0xFF),
+        .access = access,
+        .limit_high_and_flags = static_cast<u8>(((limit >> 16) & 0x0F) | (flags << 4)),
+        .base_high = static_cast<u8>((base >> 24) & 0xFF),
+    };
+}
+
+GdtEntry gdt[] = {
+    {},
+    make_gdt_entry(0, 0xFFFFF, GDT_ACCESS_CODE, GDT_FLAGS_32BIT),
+    make_gdt_entry(0, 0xFFFFF, GDT_ACCESS_DATA, GDT_FLAGS_32BIT),
+    make_gdt_entry(0, 0xFFFFF, GDT_ACCESS_DATA, GDT_FLAGS_32BIT),
+};
+
+} /* namespace */
+
+void Processor::detect_features()
+{
+    if (!has_cpuid())
+        return;
+
+    u32 max_leaf = cpuid(0).eax;
+
+    if (max_leaf >= CPUID_EXTENDED_FEATURES) {
+        CpuidResult res = cpuid(CPUID_EXTENDED_FEATURES, 0);
+        s_has_erms = res.ebx & CPUID_7_EBX_ERMS;
+        s_has_fsrm = res.edx & CPUID_7_EDX_FSRM;
+    }
+}
+
+void Processor::initialize_segments()
+{
+    GdtPointer pointer { sizeof(gdt) - 1, reinterpret_cast<u32>(&gdt) };
+
+    asm volatile("lgdt %0" ::"m"(pointer));
+
+    /* a far jump is the only way to reload CS */
+    asm volatile("ljmp %0, $1f \n\t"
+                 "1: \n\t" ::"i"(GDT_KERNEL_CODE));
+
+    asm volatile("movw %w0, %%ds \n\t"
+                 "movw %w0, %%es \n\t"
+                 "movw %w0, %%fs \n\t"
+                 "movw %w0, %%ss \n\t" ::"r"(GDT_KERNEL_DATA));
+
+    asm volatile("movw %w0, %%gs" ::"r"(GDT_THREAD_DATA));
+}
+
+void Processor::set_thread_pointer(FlatPtr base)
+{
+    gdt[GDT_THREAD_DATA / sizeof(GdtEntry)] = make_gdt_entry(base, 0xFFFFF, GDT_ACCESS_DATA, GDT_FLAGS_32BIT);
+
+    /* the CPU caches the descriptor, reloading GS makes it pick up the new base */
+    asm volatile("movw %w0, %%gs" ::"r"(GDT_THREAD_DATA) : "memory");
+}
+
+} /* namespace Kernel */
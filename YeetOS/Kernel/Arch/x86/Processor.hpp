@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <Types.hpp>
 #include <Platform.hpp>
 
 namespace Kernel {
@@ -33,6 +34,36 @@ class Processor {
 
 public:
     ALWAYS_INLINE static void spin_loop() { asm("pause"); }
+
+    /**
+     * Queries cpuid for the features below. Must be called once during early boot,
+     * until then all features read as unsupported.
+     */
+    static void detect_features();
+
+    /**
+     * Loads the kernel's GDT and reloads all segment registers from it. Must be called once during early boot.
+     */
+    static void initialize_segments();
+
+    /**
+     * Moves the base of the GS segment to `base`, the per-thread data of the running thread lives there.
+     */
+    static void set_thread_pointer(FlatPtr base);
+
+    /**
+     * Enhanced REP MOVSB/STOSB: rep movsb and rep stosb are the fastest way to copy or fill large buffers.
+     */
+    ALWAYS_INLINE static bool has_erms() { return s_has_erms; }
+
+    /**
+     * Fast Short REP MOV: rep movsb has low startup overhead, so it is fast for short copies as well.
+     */
+    ALWAYS_INLINE static bool has_fsrm() { return s_has_fsrm; }
+
+private:
+    static inline bool s_has_erms = false;
+    static inline bool s_has_fsrm = false;
 };
 
 }
\ No newline at end of file
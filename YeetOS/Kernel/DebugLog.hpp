@@ -26,6 +26,9 @@
 #pragma once
 
 #include <Types.hpp>
+#include <Format.hpp>
+#include <TypeMagic.hpp>
+#include <StringView.hpp>
 
 namespace Kernel::DebugLog {
 
@@ -33,5 +36,29 @@ void initialize();
 void putchar(char c);
 isize print(const char* msg);
 isize println(const char* msg);
+isize print(StringView msg);
+isize println(StringView msg);
+
+/**
+ * Formats `args` into a small buffer that is written out in bulk, see yt::FormatString for the syntax.
+ */
+template<typename... Args>
+isize print(yt::FormatString<typename yt::TypeIdentity<Args>::Type...> fmt, const Args&... args)
+{
+    yt::FormatBuilder builder([](void*, StringView chunk) { print(chunk); }, nullptr);
+    fmt.format(builder, args...);
+    builder.flush();
+    return builder.total();
+}
+
+template<typename... Args>
+isize println(yt::FormatString<typename yt::TypeIdentity<Args>::Type...> fmt, const Args&... args)
+{
+    yt::FormatBuilder builder([](void*, StringView chunk) { print(chunk); }, nullptr);
+    fmt.format(builder, args...);
+    builder.append('\n');
+    builder.flush();
+    return builder.total();
+}
 
 }
\ No newline at end of file
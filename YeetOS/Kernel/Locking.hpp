@@ -25,7 +25,9 @@
 
 #pragma once
 
+#include <Types.hpp>
 #include <Atomic.hpp>
+#include <Verify.hpp>
 #include <Platform.hpp>
 
 #include <Kernel/Arch/Interrupts.hpp>
@@ -66,12 +68,239 @@ private:
     Atomic<bool> m_lock { false };
 };
 
+/**
+ * Fair spinlock, CPUs acquire it in the order in which they called lock().
+ * All waiters spin on the same cache line, prefer McsLock for locks that are contended by many CPUs.
+ */
+class TicketLock {
+    NOT_COPYABLE(TicketLock);
+    NOT_MOVABLE(TicketLock);
+
+public:
+    TicketLock() {
+    }
+
+    ALWAYS_INLINE void lock() {
+        u32 ticket = m_next_ticket.fetch_add(1, MemoryOrder::Relaxed);
+
+        while (m_now_serving.load(MemoryOrder::Acquire) != ticket) {
+            Processor::spin_loop();
+        }
+    }
+
+    ALWAYS_INLINE void unlock() {
+        VERIFY(is_locked());
+        // only the owner writes m_now_serving, so there is no need for an atomic increment
+        m_now_serving.store(m_now_serving.load(MemoryOrder::Relaxed) + 1, MemoryOrder::Release);
+    }
+
+    NODISCARD ALWAYS_INLINE bool is_locked() const {
+        return m_next_ticket.load(MemoryOrder::Relaxed) != m_now_serving.load(MemoryOrder::Relaxed);
+    }
+
+private:
+    Atomic<u32> m_next_ticket { 0 };
+    Atomic<u32> m_now_serving { 0 };
+};
+
+/**
+ * Fair queued spinlock. Every waiter spins on its own Node, so a contended lock causes no cache line bouncing.
+ * The Node has to stay alive until unlock(), use McsLockLocker to keep it on the stack.
+ */
+class McsLock {
+    NOT_COPYABLE(McsLock);
+    NOT_MOVABLE(McsLock);
+
+public:
+    struct ALIGNED(cache_line_size) Node {
+        Atomic<Node*> next { nullptr };
+        Atomic<bool> waiting { false };
+    };
+
+    McsLock() {
+    }
+
+    ALWAYS_INLINE void lock(Node& node) {
+        node.next.store(nullptr, MemoryOrder::Relaxed);
+        node.waiting.store(true, MemoryOrder::Relaxed);
+
+        Node* previous = m_tail.exchange(&node, MemoryOrder::AcqRel);
+        if (previous == nullptr) {
+            return;
+        }
+
+        previous->next.store(&node, MemoryOrder::Release);
+
+        while (node.waiting.load(MemoryOrder::Acquire)) {
+            Processor::spin_loop();
+        }
+    }
+
+    ALWAYS_INLINE void unlock(Node& node) {
+        VERIFY(is_locked());
+
+        Node* next = node.next.load(MemoryOrder::Acquire);
+
+        if (next == nullptr) {
+            Node* expected = &node;
+            if (m_tail.compare_exchange(expected, nullptr, MemoryOrder::Release, MemoryOrder::Relaxed)) {
+                return;
+            }
+
+            // someone swapped the tail but has not linked itself to us yet
+            while ((next = node.next.load(MemoryOrder::Acquire)) == nullptr) {
+                Processor::spin_loop();
+            }
+        }
+
+        next->waiting.store(false, MemoryOrder::Release);
+    }
+
+    NODISCARD ALWAYS_INLINE bool is_locked() const {
+        return m_tail.load(MemoryOrder::Relaxed) != nullptr;
+    }
+
+private:
+    Atomic<Node*> m_tail { nullptr };
+};
+
+/**
+ * Spinlock that lets any number of readers in at once, or a single writer.
+ * A waiting writer keeps new readers out, so a steady stream of readers cannot starve it.
+ * Readers still write to the lock, use SeqLock for small data that is read on every CPU all the time.
+ */
+class RWSpinLock {
+    NOT_COPYABLE(RWSpinLock);
+    NOT_MOVABLE(RWSpinLock);
+
+public:
+    RWSpinLock() {
+    }
+
+    ALWAYS_INLINE void read_lock() {
+        while (true) {
+            u32 state = m_state.load(MemoryOrder::Relaxed);
+
+            if ((state & (writer_bit | writer_waiting_bit)) == 0) {
+                if (m_state.compare_exchange(state, state + reader, MemoryOrder::Acquire, MemoryOrder::Relaxed)) {
+                    return;
+                }
+
+                continue;
+            }
+
+            Processor::spin_loop();
+        }
+    }
+
+    ALWAYS_INLINE void read_unlock() {
+        VERIFY(m_state.load(MemoryOrder::Relaxed) >= reader);
+        m_state.fetch_sub(reader, MemoryOrder::Release);
+    }
+
+    ALWAYS_INLINE void write_lock() {
+        while (true) {
+            u32 state = m_state.load(MemoryOrder::Relaxed);
+
+            // taking the lock also clears writer_waiting_bit, other waiting writers set it again below
+            if ((state & ~writer_waiting_bit) == 0) {
+                if (m_state.compare_exchange(state, writer_bit, MemoryOrder::Acquire, MemoryOrder::Relaxed)) {
+                    return;
+                }
+
+                continue;
+            }
+
+            if ((state & writer_waiting_bit) == 0) {
+                m_state.fetch_or(writer_waiting_bit, MemoryOrder::Relaxed);
+            }
+
+            Processor::spin_loop();
+        }
+    }
+
+    ALWAYS_INLINE void write_unlock() {
+        VERIFY(is_write_locked());
+        m_state.fetch_and(~writer_bit, MemoryOrder::Release);
+    }
+
+    NODISCARD ALWAYS_INLINE bool is_write_locked() const {
+        return (m_state.load(MemoryOrder::Relaxed) & writer_bit) != 0;
+    }
+
+    NODISCARD ALWAYS_INLINE bool is_read_locked() const {
+        return m_state.load(MemoryOrder::Relaxed) >= reader;
+    }
+
+private:
+    static constexpr u32 writer_bit = 1;
+    static constexpr u32 writer_waiting_bit = 2;
+    static constexpr u32 reader = 4;
+
+    Atomic<u32> m_state { 0 };
+};
+
+/**
+ * Sequence lock for small data that is read much more often than written, like the current time.
+ * Readers never write to the lock, instead they retry if a writer was active while they read:
+ *
+ *     u32 sequence;
+ *     do {
+ *         sequence = lock.read_begin();
+ *         copy = data;
+ *     } while (lock.read_retry(sequence));
+ *
+ * Writers are serialized by a SpinLock and must not be interrupted by a reader on the same CPU,
+ * take the lock through SeqLockWriteLocker.
+ */
+class SeqLock {
+    NOT_COPYABLE(SeqLock);
+    NOT_MOVABLE(SeqLock);
+
+public:
+    SeqLock() {
+    }
+
+    NODISCARD ALWAYS_INLINE u32 read_begin() const {
+        u32 sequence;
+
+        // an odd sequence means a writer is in the middle of an update
+        while ((sequence = m_sequence.load(MemoryOrder::Acquire)) & 1) {
+            Processor::spin_loop();
+        }
+
+        return sequence;
+    }
+
+    NODISCARD ALWAYS_INLINE bool read_retry(u32 sequence) const {
+        yt::atomic_thread_fence(MemoryOrder::Acquire);
+        return m_sequence.load(MemoryOrder::Relaxed) != sequence;
+    }
+
+    ALWAYS_INLINE void write_lock() {
+        m_writer_lock.lock();
+        m_sequence.store(m_sequence.load(MemoryOrder::Relaxed) + 1, MemoryOrder::Relaxed);
+        yt::atomic_thread_fence(MemoryOrder::Release);
+    }
+
+    ALWAYS_INLINE void write_unlock() {
+        VERIFY(m_sequence.load(MemoryOrder::Relaxed) & 1);
+        m_sequence.store(m_sequence.load(MemoryOrder::Relaxed) + 1, MemoryOrder::Release);
+        m_writer_lock.unlock();
+    }
+
+private:
+    Atomic<u32> m_sequence { 0 };
+    SpinLock m_writer_lock;
+};
+
+template<typename LockType = SpinLock>
 class SpinLockLocker {
     NOT_COPYABLE(SpinLockLocker);
     NOT_MOVABLE(SpinLockLocker);
 
 public:
-    SpinLockLocker(SpinLock& lock) : m_lock_ref(lock), m_disabler() {
+    SpinLockLocker(LockType& lock) : m_lock_ref(lock), m_disabler() {
         m_lock_ref.lock();
     }
 
@@ -80,7 +309,80 @@ public:
     }
 
 private:
-    SpinLock& m_lock_ref;
+    LockType& m_lock_ref;
+    InterruptDisabler m_disabler;
+};
+
+class McsLockLocker {
+    NOT_COPYABLE(McsLockLocker);
+    NOT_MOVABLE(McsLockLocker);
+
+public:
+    McsLockLocker(McsLock& lock) : m_lock_ref(lock), m_disabler() {
+        m_lock_ref.lock(m_node);
+    }
+
+    ~McsLockLocker() {
+        m_lock_ref.unlock(m_node);
+    }
+
+private:
+    McsLock& m_lock_ref;
+    InterruptDisabler m_disabler;
+    McsLock::Node m_node;
+};
+
+class RWSpinLockReadLocker {
+    NOT_COPYABLE(RWSpinLockReadLocker);
+    NOT_MOVABLE(RWSpinLockReadLocker);
+
+public:
+    RWSpinLockReadLocker(RWSpinLock& lock) : m_lock_ref(lock), m_disabler() {
+        m_lock_ref.read_lock();
+    }
+
+    ~RWSpinLockReadLocker() {
+        m_lock_ref.read_unlock();
+    }
+
+private:
+    RWSpinLock& m_lock_ref;
+    InterruptDisabler m_disabler;
+};
+
+class RWSpinLockWriteLocker {
+    NOT_COPYABLE(RWSpinLockWriteLocker);
+    NOT_MOVABLE(RWSpinLockWriteLocker);
+
+public:
+    RWSpinLockWriteLocker(RWSpinLock& lock) : m_lock_ref(lock), m_disabler() {
+        m_lock_ref.write_lock();
+    }
+
+    ~RWSpinLockWriteLocker() {
+        m_lock_ref.write_unlock();
+    }
+
+private:
+    RWSpinLock& m_lock_ref;
+    InterruptDisabler m_disabler;
+};
+
+class SeqLockWriteLocker {
+    NOT_COPYABLE(SeqLockWriteLocker);
+    NOT_MOVABLE(SeqLockWriteLocker);
+
+public:
+    SeqLockWriteLocker(SeqLock& lock) : m_lock_ref(lock), m_disabler() {
+        m_lock_ref.write_lock();
+    }
+
+    ~SeqLockWriteLocker() {
+        m_lock_ref.write_unlock();
+    }
+
+private:
+    SeqLock& m_lock_ref;
     InterruptDisabler m_disabler;
 };
 
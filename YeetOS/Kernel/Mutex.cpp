@@ -0,0 +1,98 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <Types.hpp>
+#include <Atomic.hpp>
+#include <Verify.hpp>
+
+#include <Kernel/Mutex.hpp>
+#include <Kernel/Arch/Processor.hpp>
+
+namespace Kernel {
+
+/* Number of times lock() retries before the thread blocks. */
+static constexpr usize mutex_spin_count = 128;
+
+void Mutex::lock_contended()
+{
+    /*
+     * Critical sections are usually short, so spin for a bit before paying for blocking.
+     * Once there are waiters the mutex is handed to them and spinning cannot succeed anymore.
+     */
+    for (usize i = 0; i < mutex_spin_count; i++) {
+        u32 state = m_state.load(MemoryOrder::Relaxed);
+
+        if (state == locked_with_waiters) {
+            break;
+        }
+
+        if (state == unlocked && try_lock()) {
+            return;
+        }
+
+        Processor::spin_loop();
+    }
+
+    bool blocked = m_queue.wait_if([this] {
+        while (true) {
+            u32 state = m_state.load(MemoryOrder::Relaxed);
+
+            if (state == unlocked) {
+                if (m_state.compare_exchange(state, locked, MemoryOrder::Acquire, MemoryOrder::Relaxed)) {
+                    return false;
+                }
+
+                continue;
+            }
+
+            // tell unlock() that it has to wake us, it takes the queue lock after seeing this
+            if (state == locked &&
+                !m_state.compare_exchange(state, locked_with_waiters, MemoryOrder::Relaxed, MemoryOrder::Relaxed)) {
+                continue;
+            }
+
+            return true;
+        }
+    });
+
+    /* if we were blocked unlock_contended() handed us the mutex before waking us */
+    if (blocked) {
+        VERIFY(is_locked());
+    }
+}
+
+void Mutex::unlock_contended()
+{
+    m_queue.wake_one([this](bool woke_waiter, bool more_waiters) {
+        if (!woke_waiter) {
+            m_state.store(unlocked, MemoryOrder::Release);
+        } else {
+            // the mutex stays locked and now belongs to the woken thread
+            m_state.store(more_waiters ? locked_with_waiters : locked, MemoryOrder::Release);
+        }
+    });
+}
+
+} /* namespace Kernel */
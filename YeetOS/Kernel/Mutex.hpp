@@ -0,0 +1,105 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Types.hpp>
+#include <Atomic.hpp>
+#include <Verify.hpp>
+#include <Platform.hpp>
+
+#include <Kernel/WaitQueue.hpp>
+
+namespace Kernel {
+
+/**
+ * Lock for long critical sections. Unlike SpinLock it keeps interrupts enabled and blocks the thread
+ * once the lock has been contended for a short while. Must not be taken from interrupt handlers.
+ *
+ * The mutex is handed over to the longest waiting thread on unlock(), threads that arrive
+ * later cannot take it away, so no waiter starves.
+ */
+class Mutex {
+    NOT_COPYABLE(Mutex);
+    NOT_MOVABLE(Mutex);
+
+public:
+    Mutex() {
+    }
+
+    ALWAYS_INLINE void lock() {
+        if (!try_lock()) {
+            lock_contended();
+        }
+    }
+
+    NODISCARD ALWAYS_INLINE bool try_lock() {
+        u32 expected = unlocked;
+        return m_state.compare_exchange(expected, locked, MemoryOrder::Acquire, MemoryOrder::Relaxed);
+    }
+
+    ALWAYS_INLINE void unlock() {
+        VERIFY(is_locked());
+
+        u32 expected = locked;
+        if (!m_state.compare_exchange(expected, unlocked, MemoryOrder::Release, MemoryOrder::Relaxed)) {
+            unlock_contended();
+        }
+    }
+
+    NODISCARD ALWAYS_INLINE bool is_locked() const {
+        return m_state.load(MemoryOrder::Relaxed) != unlocked;
+    }
+
+private:
+    static constexpr u32 unlocked = 0;
+    static constexpr u32 locked = 1;
+    static constexpr u32 locked_with_waiters = 2;
+
+    NEVER_INLINE void lock_contended();
+    NEVER_INLINE void unlock_contended();
+
+    Atomic<u32> m_state { unlocked };
+    WaitQueue m_queue;
+};
+
+class MutexLocker {
+    NOT_COPYABLE(MutexLocker);
+    NOT_MOVABLE(MutexLocker);
+
+public:
+    MutexLocker(Mutex& mutex) : m_mutex_ref(mutex) {
+        m_mutex_ref.lock();
+    }
+
+    ~MutexLocker() {
+        m_mutex_ref.unlock();
+    }
+
+private:
+    Mutex& m_mutex_ref;
+};
+
+} /* namespace Kernel */
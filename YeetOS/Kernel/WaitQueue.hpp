@@ -0,0 +1,153 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Atomic.hpp>
+#include <Platform.hpp>
+
+#include <Kernel/Locking.hpp>
+#include <Kernel/Arch/Processor.hpp>
+
+namespace Kernel {
+
+/**
+ * FIFO queue of blocked threads. Threads are woken in the order in which they started to wait.
+ */
+class WaitQueue {
+    NOT_COPYABLE(WaitQueue);
+    NOT_MOVABLE(WaitQueue);
+
+public:
+    WaitQueue() {
+    }
+
+    /**
+     * Blocks the calling thread until it is woken by wake_one() or wake_all().
+     * `should_block` is called with the queue locked, if it returns `false` the thread does not block.
+     * This way a wakeup between checking a condition and starting to wait cannot get lost.
+     * Returns whether the thread has been blocked.
+     */
+    template<typename Predicate>
+    bool wait_if(Predicate should_block) {
+        Waiter waiter;
+
+        {
+            SpinLockLocker locker(m_lock);
+
+            if (!should_block()) {
+                return false;
+            }
+
+            enqueue(waiter);
+        }
+
+        block(waiter);
+        return true;
+    }
+
+    void wait() {
+        wait_if([] { return true; });
+    }
+
+    /**
+     * Wakes the thread that has been waiting the longest. Before it runs `update` is called with the queue
+     * locked and told whether there was a thread to wake and whether other threads are still waiting.
+     */
+    template<typename Callback>
+    void wake_one(Callback update) {
+        SpinLockLocker locker(m_lock);
+
+        Waiter* waiter = dequeue();
+        update(waiter != nullptr, m_head != nullptr);
+
+        if (waiter) {
+            // the waiter returns and destroys itself as soon as it sees this
+            waiter->woken.store(true, MemoryOrder::Release);
+        }
+    }
+
+    void wake_one() {
+        wake_one([](bool, bool) {});
+    }
+
+    void wake_all() {
+        SpinLockLocker locker(m_lock);
+
+        while (Waiter* waiter = dequeue()) {
+            waiter->woken.store(true, MemoryOrder::Release);
+        }
+    }
+
+    NODISCARD bool is_empty() const {
+        return m_head == nullptr;
+    }
+
+private:
+    struct Waiter {
+        Waiter* next { nullptr };
+        Atomic<bool> woken { false };
+    };
+
+    void enqueue(Waiter& waiter) {
+        if (m_tail) {
+            m_tail->next = &waiter;
+        } else {
+            m_head = &waiter;
+        }
+
+        m_tail = &waiter;
+    }
+
+    Waiter* dequeue() {
+        Waiter* waiter = m_head;
+
+        if (waiter) {
+            m_head = waiter->next;
+
+            if (!m_head) {
+                m_tail = nullptr;
+            }
+        }
+
+        return waiter;
+    }
+
+    /**
+     * There is no scheduler yet which could switch away from a blocked thread,
+     * until then it waits on its own Waiter, so wake_one() only touches that one cache line.
+     */
+    static void block(Waiter& waiter) {
+        while (!waiter.woken.load(MemoryOrder::Acquire)) {
+            Processor::spin_loop();
+        }
+    }
+
+    SpinLock m_lock;
+    Waiter* m_head { nullptr };
+    Waiter* m_tail { nullptr };
+};
+
+} /* namespace Kernel */
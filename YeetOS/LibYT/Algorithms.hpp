@@ -0,0 +1,132 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Invoke.hpp>
+#include <Ranges.hpp>
+#include <Utility.hpp>
+#include <Platform.hpp>
+
+namespace yt {
+
+/**
+ * Calls `func` on each element in [begin, end).
+ */
+template<Iterator Iter, SentinelFor<Iter> Sent, typename Func>
+constexpr void for_each(Iter begin, Sent end, Func func) {
+    for (; begin != end; ++begin) {
+        invoke(func, *begin);
+    }
+}
+
+/**
+ * Checks whether any element in [begin, end) satisfies `pred`.
+ */
+template<Iterator Iter, SentinelFor<Iter> Sent, typename Pred>
+constexpr bool any_of(Iter begin, Sent end, Pred pred) {
+    for (; begin != end; ++begin) {
+        if (invoke(pred, *begin)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Counts the elements in [begin, end) that satisfy `pred`.
+ */
+template<Iterator Iter, SentinelFor<Iter> Sent, typename Pred>
+constexpr usize count_if(Iter begin, Sent end, Pred pred) {
+    usize count = 0;
+
+    for (; begin != end; ++begin) {
+        count += invoke(pred, *begin) ? 1 : 0;
+    }
+
+    return count;
+}
+
+/**
+ * Folds the elements in [begin, end) into `init` from left to right using `op`.
+ */
+template<Iterator Iter, SentinelFor<Iter> Sent, typename T, typename BinaryOp>
+constexpr T accumulate(Iter begin, Sent end, T init, BinaryOp op) {
+    for (; begin != end; ++begin) {
+        init = invoke(op, move(init), *begin);
+    }
+
+    return init;
+}
+
+/**
+ * Sums up the elements in [begin, end) starting with `init`.
+ */
+template<Iterator Iter, SentinelFor<Iter> Sent, typename T>
+constexpr T accumulate(Iter begin, Sent end, T init) {
+    for (; begin != end; ++begin) {
+        init = move(init) + *begin;
+    }
+
+    return init;
+}
+
+template<typename Rng, typename Func>
+requires Range<Rng>
+constexpr void for_each(Rng&& range, Func func) {
+    for_each(rng::begin(range), rng::end(range), move(func));
+}
+
+template<typename Rng, typename Pred>
+requires Range<Rng>
+constexpr bool any_of(Rng&& range, Pred pred) {
+    return any_of(rng::begin(range), rng::end(range), move(pred));
+}
+
+template<typename Rng, typename Pred>
+requires Range<Rng>
+constexpr usize count_if(Rng&& range, Pred pred) {
+    return count_if(rng::begin(range), rng::end(range), move(pred));
+}
+
+template<typename Rng, typename T, typename BinaryOp>
+requires Range<Rng>
+constexpr T accumulate(Rng&& range, T init, BinaryOp op) {
+    return accumulate(rng::begin(range), rng::end(range), move(init), move(op));
+}
+
+template<typename Rng, typename T>
+requires Range<Rng>
+constexpr T accumulate(Rng&& range, T init) {
+    return accumulate(rng::begin(range), rng::end(range), move(init));
+}
+
+} /* namespace yt */
+
+using yt::accumulate;
+using yt::any_of;
+using yt::count_if;
+using yt::for_each;
\ No newline at end of file
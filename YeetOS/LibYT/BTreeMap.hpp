@@ -0,0 +1,928 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <New.hpp>
+#include <Types.hpp>
+#include <Option.hpp>
+#include <Ranges.hpp>
+#include <Verify.hpp>
+#include <Utility.hpp>
+#include <Platform.hpp>
+#include <BinarySearch.hpp>
+
+namespace yt {
+
+namespace Detail {
+
+/**
+ * Moves `value` into `array[index]`, shifting the elements behind it one slot to the right.
+ * The slot `array[count]` must be uninitialized.
+ */
+template<typename T>
+ALWAYS_INLINE void btree_insert_at(T* array, usize count, usize index, T&& value) {
+    if (index == count) {
+        new (array + count) T(move(value));
+        return;
+    }
+
+    new (array + count) T(move(array[count - 1]));
+
+    for (usize i = count - 1; i > index; i--) {
+        array[i] = move(array[i - 1]);
+    }
+
+    array[index] = move(value);
+}
+
+/**
+ * Removes `array[index]`, shifting the elements behind it one slot to the left.
+ */
+template<typename T>
+ALWAYS_INLINE void btree_erase_at(T* array, usize count, usize index) {
+    for (usize i = index; i + 1 < count; i++) {
+        array[i] = move(array[i + 1]);
+    }
+
+    array[count - 1].~T();
+}
+
+/**
+ * Moves `count` elements from `src` into the uninitialized `dest` and destroys the sources.
+ */
+template<typename T>
+ALWAYS_INLINE void btree_relocate(T* dest, T* src, usize count) {
+    for (usize i = 0; i < count; i++) {
+        new (dest + i) T(move(src[i]));
+        src[i].~T();
+    }
+}
+
+} /* namespace Detail */
+
+/**
+ * An element of a `BTreeMap` as seen through its iterators.
+ */
+template<typename K, typename V>
+struct BTreeMapEntry {
+    const K& key;
+    V& value;
+};
+
+/**
+ * An ordered map implemented as a B+ tree.
+ *
+ * Nodes are aligned to cache lines, span `node_size` bytes and hold many keys each, so a lookup
+ * touches far fewer cache lines than a binary tree of the same size. All entries live in the leaves, which
+ * are linked in key order, making iteration over a range of keys a linear walk.
+ *
+ * @tparam K the key type, must be copyable since the inner nodes hold copies of leaf keys as separators.
+ * @tparam V the value type.
+ * @tparam Compare the strict weak ordering of the keys.
+ */
+template<typename K, typename V, typename Compare = Less>
+requires Copyable<K> && Movable<V>
+class BTreeMap {
+    NOT_COPYABLE(BTreeMap);
+
+    /* the layouts of LeafNode and InnerNode below for a given capacity */
+    static constexpr usize leaf_bytes(usize capacity) noexcept {
+        usize keys_end = align_up(4 * sizeof(void*), alignof(K)) + sizeof(K) * (capacity + 1);
+        return align_up(keys_end, alignof(V)) + sizeof(V) * (capacity + 1);
+    }
+
+    static constexpr usize inner_bytes(usize capacity) noexcept {
+        return align_up(sizeof(void*) * (capacity + 4), alignof(K)) + sizeof(K) * (capacity + 1);
+    }
+
+public:
+    static constexpr usize node_size = 4 * cache_line_size;
+
+    /* the largest capacities for which a node, including the spare slot used while splitting, fits node_size */
+    static constexpr usize leaf_capacity = [] {
+        usize capacity = (node_size - 4 * sizeof(void*)) / (sizeof(K) + sizeof(V));
+        while (capacity > 5 && leaf_bytes(capacity - 1) > node_size) {
+            capacity--;
+        }
+        return max<usize>(5, capacity) - 1;
+    }();
+
+    static constexpr usize inner_capacity = [] {
+        usize capacity = (node_size - 3 * sizeof(void*)) / (sizeof(K) + sizeof(void*));
+        while (capacity > 5 && inner_bytes(capacity - 1) > node_size) {
+            capacity--;
+        }
+        return max<usize>(5, capacity) - 1;
+    }();
+
+    static constexpr usize min_leaf_count = leaf_capacity / 2;
+    static constexpr usize min_inner_count = inner_capacity / 2;
+
+private:
+    struct Node {
+        usize count { 0 };
+        bool is_leaf;
+
+        explicit Node(bool leaf) noexcept : is_leaf(leaf) {}
+    };
+
+    /* both node types have room for one element more than their capacity, so they can be split after inserting */
+    struct ALIGNED(cache_line_size) LeafNode : Node {
+        LeafNode* prev { nullptr };
+        LeafNode* next { nullptr };
+        alignas(K) Byte key_storage[sizeof(K) * (leaf_capacity + 1)];
+        alignas(V) Byte value_storage[sizeof(V) * (leaf_capacity + 1)];
+
+        LeafNode() noexcept : Node(true) {}
+
+        ALWAYS_INLINE K* keys() noexcept {
+            return __builtin_launder(reinterpret_cast<K*>(key_storage));
+        }
+
+        ALWAYS_INLINE V* values() noexcept {
+            return __builtin_launder(reinterpret_cast<V*>(value_storage));
+        }
+    };
+
+    struct ALIGNED(cache_line_size) InnerNode : Node {
+        Node* children[inner_capacity + 2];
+        alignas(K) Byte key_storage[sizeof(K) * (inner_capacity + 1)];
+
+        InnerNode() noexcept : Node(false) {}
+
+        ALWAYS_INLINE K* keys() noexcept {
+            return __builtin_launder(reinterpret_cast<K*>(key_storage));
+        }
+    };
+
+    /* only very large keys or values, which get the minimum capacity, may need more */
+    static_assert(sizeof(LeafNode) <= node_size || leaf_capacity == 4);
+    static_assert(sizeof(InnerNode) <= node_size || inner_capacity == 4);
+
+    template<bool IsConst>
+    class IteratorBase {
+        friend class BTreeMap;
+
+    public:
+        using ValueType = BTreeMapEntry<K, conditional<IsConst, const V, V>>;
+
+        ALWAYS_INLINE IteratorBase() noexcept = default;
+
+        ALWAYS_INLINE ValueType operator*() const noexcept {
+            return { m_leaf->keys()[m_index], m_leaf->values()[m_index] };
+        }
+
+        ALWAYS_INLINE IteratorBase& operator++() noexcept {
+            if (++m_index == m_leaf->count) {
+                m_leaf = m_leaf->next;
+                m_index = 0;
+            }
+            return *this;
+        }
+
+        ALWAYS_INLINE IteratorBase operator++(int) noexcept {
+            IteratorBase temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        ALWAYS_INLINE bool operator==(const IteratorBase& other) const noexcept {
+            return m_leaf == other.m_leaf && m_index == other.m_index;
+        }
+
+    private:
+        ALWAYS_INLINE IteratorBase(LeafNode* leaf, usize index) noexcept : m_leaf(leaf), m_index(index) {
+            if (m_leaf && m_index == m_leaf->count) {
+                m_leaf = m_leaf->next;
+                m_index = 0;
+            }
+        }
+
+    private:
+        LeafNode* m_leaf { nullptr };
+        usize m_index { 0 };
+    };
+
+public:
+    using IteratorType = IteratorBase<false>;
+    using ConstIteratorType = IteratorBase<true>;
+
+    ALWAYS_INLINE BTreeMap() noexcept = default;
+
+    BTreeMap(BTreeMap&& other) noexcept
+        : m_root(exchange(other.m_root, nullptr)), m_first(exchange(other.m_first, nullptr)),
+          m_last(exchange(other.m_last, nullptr)), m_size(exchange(other.m_size, 0)) {}
+
+    BTreeMap& operator=(BTreeMap&& other) noexcept {
+        if (this != &other) {
+            clear();
+            m_root = exchange(other.m_root, nullptr);
+            m_first = exchange(other.m_first, nullptr);
+            m_last = exchange(other.m_last, nullptr);
+            m_size = exchange(other.m_size, 0);
+        }
+        return *this;
+    }
+
+    ~BTreeMap() {
+        clear();
+    }
+
+    /**
+     * Builds a map from a range of entries with `key` and `value` members, sorted by strictly increasing keys.
+     *
+     * The leaves are filled directly and the inner levels are built bottom-up, which is linear
+     * in the number of entries and leaves every node nearly full.
+     */
+    template<typename Rng>
+    requires Range<Rng>
+    static BTreeMap from_sorted(Rng&& entries) {
+        BTreeMap map;
+
+        usize count = 0;
+        for (auto it = rng::begin(entries); it != rng::end(entries); ++it) {
+            count++;
+        }
+
+        if (count == 0) {
+            return map;
+        }
+
+        usize leaf_count = (count + leaf_capacity - 1) / leaf_capacity;
+        usize level_bytes = leaf_count * sizeof(Node*);
+        Node** level = static_cast<Node**>(::operator new(level_bytes));
+
+        /* spread the entries evenly, so no leaf ends up below the minimum */
+        auto it = rng::begin(entries);
+        LeafNode* prev = nullptr;
+        UNUSED const K* previous_key = nullptr;
+
+        for (usize i = 0; i < leaf_count; i++) {
+            LeafNode* leaf = new LeafNode;
+            usize leaf_size = count / leaf_count + (i < count % leaf_count ? 1 : 0);
+
+            for (usize j = 0; j < leaf_size; j++, ++it) {
+                auto&& entry = *it;
+                VERIFY(!previous_key || less(*previous_key, entry.key));
+
+                new (leaf->keys() + j) K(entry.key);
+                new (leaf->values() + j) V(entry.value);
+                previous_key = leaf->keys() + j;
+                leaf->count++;
+                map.m_size++;
+            }
+
+            leaf->prev = prev;
+            if (prev) {
+                prev->next = leaf;
+            } else {
+                map.m_first = leaf;
+            }
+
+            prev = leaf;
+            map.m_last = leaf;
+            level[i] = leaf;
+        }
+
+        usize level_count = leaf_count;
+
+        while (level_count > 1) {
+            usize parent_count = (level_count + inner_capacity) / (inner_capacity + 1);
+            usize child = 0;
+
+            for (usize i = 0; i < parent_count; i++) {
+                InnerNode* inner = new InnerNode;
+                usize child_count = level_count / parent_count + (i < level_count % parent_count ? 1 : 0);
+
+                inner->children[0] = level[child++];
+
+                for (usize j = 1; j < child_count; j++) {
+                    Node* node = level[child++];
+                    new (inner->keys() + j - 1) K(min_key(node));
+                    inner->children[j] = node;
+                    inner->count++;
+                }
+
+                level[i] = inner;
+            }
+
+            level_count = parent_count;
+        }
+
+        map.m_root = level[0];
+        ::operator delete(level, level_bytes);
+
+        return map;
+    }
+
+    NODISCARD ALWAYS_INLINE usize size() const noexcept {
+        return m_size;
+    }
+
+    NODISCARD ALWAYS_INLINE bool is_empty() const noexcept {
+        return m_size == 0;
+    }
+
+    /**
+     * Returns the value stored for `key`.
+     */
+    NODISCARD Option<V&> get(const K& key) noexcept {
+        IteratorType it = find(key);
+
+        if (it == end()) {
+            return {};
+        }
+
+        return (*it).value;
+    }
+
+    /**
+     * Returns the value stored for `key`.
+     */
+    NODISCARD Option<const V&> get(const K& key) const noexcept {
+        ConstIteratorType it = find(key);
+
+        if (it == end()) {
+            return {};
+        }
+
+        return (*it).value;
+    }
+
+    NODISCARD ALWAYS_INLINE bool contains(const K& key) const noexcept {
+        return find(key) != end();
+    }
+
+    /**
+     * Stores `value` for `key`, replacing any previous value.
+     *
+     * @returns whether the key was newly inserted.
+     */
+    bool set(K key, V value) {
+        if (!m_root) {
+            LeafNode* leaf = new LeafNode;
+            new (leaf->keys()) K(move(key));
+            new (leaf->values()) V(move(value));
+            leaf->count = 1;
+
+            m_root = m_first = m_last = leaf;
+            m_size = 1;
+            return true;
+        }
+
+        Path path;
+        LeafNode* leaf = find_leaf(key, &path);
+        usize index = yt::lower_bound(leaf->keys(), leaf->keys() + leaf->count, key, Compare {}) - leaf->keys();
+
+        if (index < leaf->count && !less(key, leaf->keys()[index])) {
+            leaf->values()[index] = move(value);
+            return false;
+        }
+
+        Detail::btree_insert_at(leaf->keys(), leaf->count, index, move(key));
+        Detail::btree_insert_at(leaf->values(), leaf->count, index, move(value));
+        leaf->count++;
+        m_size++;
+
+        if (leaf->count > leaf_capacity) {
+            split_leaf(leaf, path);
+        }
+
+        return true;
+    }
+
+    /**
+     * Removes `key` and its value.
+     *
+     * @returns whether the key was present.
+     */
+    bool remove(const K& key) {
+        if (!m_root) {
+            return false;
+        }
+
+        Path path;
+        LeafNode* leaf = find_leaf(key, &path);
+        usize index = yt::lower_bound(leaf->keys(), leaf->keys() + leaf->count, key, Compare {}) - leaf->keys();
+
+        if (index == leaf->count || less(key, leaf->keys()[index])) {
+            return false;
+        }
+
+        Detail::btree_erase_at(leaf->keys(), leaf->count, index);
+        Detail::btree_erase_at(leaf->values(), leaf->count, index);
+        leaf->count--;
+        m_size--;
+
+        if (m_size == 0) {
+            delete leaf;
+            m_root = m_first = m_last = nullptr;
+            return true;
+        }
+
+        rebalance_leaf(leaf, path);
+        return true;
+    }
+
+    void clear() noexcept {
+        if (m_root) {
+            destroy(m_root);
+        }
+
+        m_root = m_first = m_last = nullptr;
+        m_size = 0;
+    }
+
+    /**
+     * Returns an iterator to the entry with `key`, or `end()` if there is none.
+     */
+    NODISCARD IteratorType find(const K& key) noexcept {
+        IteratorType it = lower_bound(key);
+        return it != end() && !less(key, (*it).key) ? it : end();
+    }
+
+    NODISCARD ConstIteratorType find(const K& key) const noexcept {
+        ConstIteratorType it = lower_bound(key);
+        return it != end() && !less(key, (*it).key) ? it : end();
+    }
+
+    /**
+     * Returns an iterator to the first entry whose key is not less than `key`.
+     */
+    NODISCARD IteratorType lower_bound(const K& key) noexcept {
+        return bound<IteratorType, false>(key);
+    }
+
+    NODISCARD ConstIteratorType lower_bound(const K& key) const noexcept {
+        return bound<ConstIteratorType, false>(key);
+    }
+
+    /**
+     * Returns an iterator to the first entry whose key is greater than `key`.
+     */
+    NODISCARD IteratorType upper_bound(const K& key) noexcept {
+        return bound<IteratorType, true>(key);
+    }
+
+    NODISCARD ConstIteratorType upper_bound(const K& key) const noexcept {
+        return bound<ConstIteratorType, true>(key);
+    }
+
+    /**
+     * Returns the entries with keys in [from, to).
+     */
+    NODISCARD IteratorRange<IteratorType> range(const K& from, const K& to) noexcept {
+        return { lower_bound(from), lower_bound(to) };
+    }
+
+    NODISCARD IteratorRange<ConstIteratorType> range(const K& from, const K& to) const noexcept {
+        return { lower_bound(from), lower_bound(to) };
+    }
+
+    NODISCARD ALWAYS_INLINE IteratorType begin() noexcept {
+        return IteratorType(m_first, 0);
+    }
+
+    NODISCARD ALWAYS_INLINE ConstIteratorType begin() const noexcept {
+        return ConstIteratorType(m_first, 0);
+    }
+
+    NODISCARD ALWAYS_INLINE IteratorType end() noexcept {
+        return IteratorType();
+    }
+
+    NODISCARD ALWAYS_INLINE ConstIteratorType end() const noexcept {
+        return ConstIteratorType();
+    }
+
+    /**
+     * Walks the whole tree and checks its structure: key order within the separators, node fill counts,
+     * equal depth of all leaves, the leaf links and the size. Linear in the size of the map, meant for tests.
+     */
+    NODISCARD bool check_invariants() const noexcept {
+        if (!m_root) {
+            return m_size == 0 && !m_first && !m_last;
+        }
+
+        InvariantWalk walk;
+
+        if (!check_node(m_root, nullptr, nullptr, 0, walk)) {
+            return false;
+        }
+
+        return walk.previous_leaf == m_last && !m_last->next && walk.entries == m_size;
+    }
+
+private:
+    /**
+     * State carried through the in-order walk of check_invariants().
+     */
+    struct InvariantWalk {
+        LeafNode* previous_leaf { nullptr };
+        usize leaf_depth { 0 };
+        usize entries { 0 };
+    };
+
+    /* keys in the subtree of `node` must lie in [lower, upper), a null bound is unbounded */
+    bool check_node(Node* node, const K* lower, const K* upper, usize depth, InvariantWalk& walk) const noexcept {
+        bool is_root = node == m_root;
+
+        auto in_bounds = [&](const K& key) {
+            return (!lower || !less(key, *lower)) && (!upper || less(key, *upper));
+        };
+
+        if (node->is_leaf) {
+            LeafNode* leaf = static_cast<LeafNode*>(node);
+
+            if (leaf->count < (is_root ? 1 : min_leaf_count) || leaf->count > leaf_capacity) {
+                return false;
+            }
+
+            for (usize i = 0; i < leaf->count; i++) {
+                if (!in_bounds(leaf->keys()[i]) || (i > 0 && !less(leaf->keys()[i - 1], leaf->keys()[i]))) {
+                    return false;
+                }
+            }
+
+            if (walk.previous_leaf ? walk.leaf_depth != depth || walk.previous_leaf->next != leaf : m_first != leaf) {
+                return false;
+            }
+
+            if (leaf->prev != walk.previous_leaf) {
+                return false;
+            }
+
+            walk.previous_leaf = leaf;
+            walk.leaf_depth = depth;
+            walk.entries += leaf->count;
+            return true;
+        }
+
+        InnerNode* inner = static_cast<InnerNode*>(node);
+
+        if (inner->count < (is_root ? 1 : min_inner_count) || inner->count > inner_capacity) {
+            return false;
+        }
+
+        for (usize i = 0; i < inner->count; i++) {
+            if (!in_bounds(inner->keys()[i]) || (i > 0 && !less(inner->keys()[i - 1], inner->keys()[i]))) {
+                return false;
+            }
+        }
+
+        for (usize i = 0; i <= inner->count; i++) {
+            const K* child_lower = i > 0 ? inner->keys() + i - 1 : lower;
+            const K* child_upper = i < inner->count ? inner->keys() + i : upper;
+
+            if (!check_node(inner->children[i], child_lower, child_upper, depth + 1, walk)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * The inner nodes visited on the way down to a leaf and the index of the child taken in each.
+     */
+    struct Path {
+        static constexpr usize max_height = 32;
+
+        InnerNode* nodes[max_height];
+        usize indices[max_height];
+        usize height { 0 };
+
+        ALWAYS_INLINE void push(InnerNode* node, usize index) noexcept {
+            VERIFY(height < max_height);
+            nodes[height] = node;
+            indices[height] = index;
+            height++;
+        }
+    };
+
+    ALWAYS_INLINE static bool less(const K& a, const K& b) noexcept {
+        return Compare {}(a, b);
+    }
+
+    ALWAYS_INLINE static usize child_index(InnerNode* node, const K& key) noexcept {
+        return yt::upper_bound(node->keys(), node->keys() + node->count, key, Compare {}) - node->keys();
+    }
+
+    static const K& min_key(Node* node) noexcept {
+        while (!node->is_leaf) {
+            node = static_cast<InnerNode*>(node)->children[0];
+        }
+
+        return static_cast<LeafNode*>(node)->keys()[0];
+    }
+
+    LeafNode* find_leaf(const K& key, Path* path) const noexcept {
+        Node* node = m_root;
+
+        while (!node->is_leaf) {
+            InnerNode* inner = static_cast<InnerNode*>(node);
+            usize index = child_index(inner, key);
+
+            if (path) {
+                path->push(inner, index);
+            }
+
+            node = inner->children[index];
+        }
+
+        return static_cast<LeafNode*>(node);
+    }
+
+    template<typename Iter, bool Upper>
+    Iter bound(const K& key) const noexcept {
+        if (!m_root) {
+            return Iter();
+        }
+
+        LeafNode* leaf = find_leaf(key, nullptr);
+        K* keys = leaf->keys();
+
+        if constexpr (Upper) {
+            return Iter(leaf, yt::upper_bound(keys, keys + leaf->count, key, Compare {}) - keys);
+        } else {
+            return Iter(leaf, yt::lower_bound(keys, keys + leaf->count, key, Compare {}) - keys);
+        }
+    }
+
+    void split_leaf(LeafNode* leaf, Path& path) {
+        LeafNode* right = new LeafNode;
+        usize middle = leaf->count / 2;
+
+        Detail::btree_relocate(right->keys(), leaf->keys() + middle, leaf->count - middle);
+        Detail::btree_relocate(right->values(), leaf->values() + middle, leaf->count - middle);
+        right->count = leaf->count - middle;
+        leaf->count = middle;
+
+        right->prev = leaf;
+        right->next = leaf->next;
+
+        if (leaf->next) {
+            leaf->next->prev = right;
+        } else {
+            m_last = right;
+        }
+
+        leaf->next = right;
+
+        insert_into_parent(leaf, K(right->keys()[0]), right, path);
+    }
+
+    void insert_into_parent(Node* left, K separator, Node* right, Path& path) {
+        while (path.height > 0) {
+            path.height--;
+            InnerNode* parent = path.nodes[path.height];
+            usize index = path.indices[path.height];
+
+            Detail::btree_insert_at(parent->keys(), parent->count, index, move(separator));
+            Detail::btree_insert_at(parent->children, parent->count + 1, index + 1, move(right));
+            parent->count++;
+
+            if (parent->count <= inner_capacity) {
+                return;
+            }
+
+            /* the middle key moves up, the keys behind it go to the new right sibling */
+            InnerNode* sibling = new InnerNode;
+            usize middle = parent->count / 2;
+            usize moved = parent->count - middle - 1;
+
+            separator = move(parent->keys()[middle]);
+            parent->keys()[middle].~K();
+
+            Detail::btree_relocate(sibling->keys(), parent->keys() + middle + 1, moved);
+            for (usize i = 0; i <= moved; i++) {
+                sibling->children[i] = parent->children[middle + 1 + i];
+            }
+
+            sibling->count = moved;
+            parent->count = middle;
+
+            left = parent;
+            right = sibling;
+        }
+
+        InnerNode* root = new InnerNode;
+        new (root->keys()) K(move(separator));
+        root->children[0] = left;
+        root->children[1] = right;
+        root->count = 1;
+        m_root = root;
+    }
+
+    /**
+     * Removes the key at `index` and the child right of it from an inner node.
+     */
+    static void erase_from_inner(InnerNode* node, usize index) noexcept {
+        Detail::btree_erase_at(node->keys(), node->count, index);
+
+        for (usize i = index + 1; i < node->count; i++) {
+            node->children[i] = node->children[i + 1];
+        }
+
+        node->count--;
+    }
+
+    void rebalance_leaf(LeafNode* leaf, Path& path) {
+        if (path.height == 0 || leaf->count >= min_leaf_count) {
+            return;
+        }
+
+        InnerNode* parent = path.nodes[path.height - 1];
+        usize index = path.indices[path.height - 1];
+
+        LeafNode* left = index > 0 ? static_cast<LeafNode*>(parent->children[index - 1]) : nullptr;
+        LeafNode* right = index < parent->count ? static_cast<LeafNode*>(parent->children[index + 1]) : nullptr;
+
+        if (left && left->count > min_leaf_count) {
+            Detail::btree_insert_at(leaf->keys(), leaf->count, 0, move(left->keys()[left->count - 1]));
+            Detail::btree_insert_at(leaf->values(), leaf->count, 0, move(left->values()[left->count - 1]));
+            leaf->count++;
+
+            left->keys()[left->count - 1].~K();
+            left->values()[left->count - 1].~V();
+            left->count--;
+
+            parent->keys()[index - 1] = leaf->keys()[0];
+            return;
+        }
+
+        if (right && right->count > min_leaf_count) {
+            new (leaf->keys() + leaf->count) K(move(right->keys()[0]));
+            new (leaf->values() + leaf->count) V(move(right->values()[0]));
+            leaf->count++;
+
+            Detail::btree_erase_at(right->keys(), right->count, 0);
+            Detail::btree_erase_at(right->values(), right->count, 0);
+            right->count--;
+
+            parent->keys()[index] = right->keys()[0];
+            return;
+        }
+
+        if (left) {
+            merge_leaves(left, leaf);
+            erase_from_inner(parent, index - 1);
+        } else {
+            merge_leaves(leaf, right);
+            erase_from_inner(parent, index);
+        }
+
+        path.height--;
+        rebalance_inner(parent, path);
+    }
+
+    void merge_leaves(LeafNode* left, LeafNode* right) noexcept {
+        Detail::btree_relocate(left->keys() + left->count, right->keys(), right->count);
+        Detail::btree_relocate(left->values() + left->count, right->values(), right->count);
+        left->count += right->count;
+
+        left->next = right->next;
+
+        if (right->next) {
+            right->next->prev = left;
+        } else {
+            m_last = left;
+        }
+
+        delete right;
+    }
+
+    void rebalance_inner(InnerNode* node, Path& path) {
+        if (path.height == 0) {
+            /* the root may shrink down to a single child, which then becomes the new root */
+            if (node->count == 0) {
+                m_root = node->children[0];
+                delete node;
+            }
+            return;
+        }
+
+        if (node->count >= min_inner_count) {
+            return;
+        }
+
+        InnerNode* parent = path.nodes[path.height - 1];
+        usize index = path.indices[path.height - 1];
+
+        InnerNode* left = index > 0 ? static_cast<InnerNode*>(parent->children[index - 1]) : nullptr;
+        InnerNode* right = index < parent->count ? static_cast<InnerNode*>(parent->children[index + 1]) : nullptr;
+
+        if (left && left->count > min_inner_count) {
+            Detail::btree_insert_at(node->keys(), node->count, 0, move(parent->keys()[index - 1]));
+            Detail::btree_insert_at(node->children, node->count + 1, 0, move(left->children[left->count]));
+            node->count++;
+
+            parent->keys()[index - 1] = move(left->keys()[left->count - 1]);
+            left->keys()[left->count - 1].~K();
+            left->count--;
+            return;
+        }
+
+        if (right && right->count > min_inner_count) {
+            new (node->keys() + node->count) K(move(parent->keys()[index]));
+            node->children[node->count + 1] = right->children[0];
+            node->count++;
+
+            parent->keys()[index] = move(right->keys()[0]);
+            Detail::btree_erase_at(right->keys(), right->count, 0);
+
+            for (usize i = 0; i < right->count; i++) {
+                right->children[i] = right->children[i + 1];
+            }
+
+            right->count--;
+            return;
+        }
+
+        if (left) {
+            merge_inner(left, parent, index - 1, node);
+        } else {
+            merge_inner(node, parent, index, right);
+        }
+
+        path.height--;
+        rebalance_inner(parent, path);
+    }
+
+    /**
+     * Merges `right` and the separating key of `parent` into `left`.
+     */
+    static void merge_inner(InnerNode* left, InnerNode* parent, usize index, InnerNode* right) noexcept {
+        new (left->keys() + left->count) K(move(parent->keys()[index]));
+        Detail::btree_relocate(left->keys() + left->count + 1, right->keys(), right->count);
+
+        for (usize i = 0; i <= right->count; i++) {
+            left->children[left->count + 1 + i] = right->children[i];
+        }
+
+        left->count += right->count + 1;
+        delete right;
+
+        erase_from_inner(parent, index);
+    }
+
+    static void destroy(Node* node) noexcept {
+        if (node->is_leaf) {
+            LeafNode* leaf = static_cast<LeafNode*>(node);
+
+            for (usize i = 0; i < leaf->count; i++) {
+                leaf->keys()[i].~K();
+                leaf->values()[i].~V();
+            }
+
+            delete leaf;
+            return;
+        }
+
+        InnerNode* inner = static_cast<InnerNode*>(node);
+
+        for (usize i = 0; i <= inner->count; i++) {
+            destroy(inner->children[i]);
+        }
+
+        for (usize i = 0; i < inner->count; i++) {
+            inner->keys()[i].~K();
+        }
+
+        delete inner;
+    }
+
+private:
+    Node* m_root { nullptr };
+    LeafNode* m_first { nullptr };
+    LeafNode* m_last { nullptr };
+    usize m_size { 0 };
+};
+
+} /* namespace yt */
+
+using yt::BTreeMap;
+using yt::BTreeMapEntry;
\ No newline at end of file
@@ -0,0 +1,243 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Array.hpp>
+#include <Slice.hpp>
+#include <Types.hpp>
+#include <Option.hpp>
+#include <Ranges.hpp>
+#include <Utility.hpp>
+#include <Builtins.hpp>
+#include <Platform.hpp>
+
+namespace yt {
+
+/**
+ * A pair of iterators that can be used in a range-based for loop.
+ */
+template<typename Iter>
+struct IteratorRange {
+    Iter first;
+    Iter last;
+
+    NODISCARD ALWAYS_INLINE constexpr Iter begin() const noexcept {
+        return first;
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr Iter end() const noexcept {
+        return last;
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr bool is_empty() const noexcept {
+        return first == last;
+    }
+};
+
+/**
+ * Returns the first position in the sorted range [begin, end) whose element is not less than `value`.
+ */
+template<RandomAccessIterator Iter, typename T, typename Compare = Less>
+constexpr Iter lower_bound(Iter begin, Iter end, const T& value, Compare comp = {}) {
+    isize count = end - begin;
+
+    while (count > 0) {
+        isize half = count / 2;
+        Iter middle = begin + half;
+
+        if (comp(*middle, value)) {
+            begin = middle + 1;
+            count -= half + 1;
+        } else {
+            count = half;
+        }
+    }
+
+    return begin;
+}
+
+/**
+ * Returns the first position in the sorted range [begin, end) whose element is greater than `value`.
+ */
+template<RandomAccessIterator Iter, typename T, typename Compare = Less>
+constexpr Iter upper_bound(Iter begin, Iter end, const T& value, Compare comp = {}) {
+    isize count = end - begin;
+
+    while (count > 0) {
+        isize half = count / 2;
+        Iter middle = begin + half;
+
+        if (!comp(value, *middle)) {
+            begin = middle + 1;
+            count -= half + 1;
+        } else {
+            count = half;
+        }
+    }
+
+    return begin;
+}
+
+/**
+ * Returns the part of the sorted range [begin, end) that is equal to `value`.
+ */
+template<RandomAccessIterator Iter, typename T, typename Compare = Less>
+constexpr IteratorRange<Iter> equal_range(Iter begin, Iter end, const T& value, Compare comp = {}) {
+    Iter first = lower_bound(begin, end, value, comp);
+    return { first, upper_bound(first, end, value, comp) };
+}
+
+/**
+ * Checks whether the sorted range [begin, end) contains an element equal to `value`.
+ */
+template<RandomAccessIterator Iter, typename T, typename Compare = Less>
+constexpr bool binary_search(Iter begin, Iter end, const T& value, Compare comp = {}) {
+    Iter it = lower_bound(begin, end, value, comp);
+    return it != end && !comp(value, *it);
+}
+
+template<typename Rng, typename T, typename Compare = Less>
+requires RandomAccessRange<Rng>
+constexpr auto lower_bound(Rng&& range, const T& value, Compare comp = {}) {
+    return lower_bound(rng::begin(range), rng::end(range), value, move(comp));
+}
+
+template<typename Rng, typename T, typename Compare = Less>
+requires RandomAccessRange<Rng>
+constexpr auto upper_bound(Rng&& range, const T& value, Compare comp = {}) {
+    return upper_bound(rng::begin(range), rng::end(range), value, move(comp));
+}
+
+template<typename Rng, typename T, typename Compare = Less>
+requires RandomAccessRange<Rng>
+constexpr auto equal_range(Rng&& range, const T& value, Compare comp = {}) {
+    return equal_range(rng::begin(range), rng::end(range), value, move(comp));
+}
+
+template<typename Rng, typename T, typename Compare = Less>
+requires RandomAccessRange<Rng>
+constexpr bool binary_search(Rng&& range, const T& value, Compare comp = {}) {
+    return binary_search(rng::begin(range), rng::end(range), value, move(comp));
+}
+
+/**
+ * Returns the index of the first element in the sorted slice that is not less than `value`,
+ * or `values.size()` if there is none.
+ *
+ * The loop body has no data dependent branch: the comparison result selects the next
+ * base with a conditional move, so the loop runs exactly log2(n) times and never mispredicts.
+ */
+template<typename T, typename U, typename Compare = Less>
+constexpr usize branchless_lower_bound(Slice<T> values, const U& value, Compare comp = {}) {
+    const T* base = values.data();
+    usize count = values.size();
+
+    if (count == 0) {
+        return 0;
+    }
+
+    while (count > 1) {
+        usize half = count / 2;
+        base = comp(base[half - 1], value) ? base + half : base;
+        count -= half;
+    }
+
+    return (base - values.data()) + comp(*base, value);
+}
+
+template<typename T, usize N, typename U, typename Compare = Less>
+constexpr usize branchless_lower_bound(const Array<T, N>& values, const U& value, Compare comp = {}) {
+    return branchless_lower_bound(Slice<const T>(values.data(), N), value, move(comp));
+}
+
+namespace Detail {
+
+template<typename T>
+constexpr usize build_eytzinger(Slice<const T> sorted, Slice<T> out, usize i, usize k) {
+    if (k <= out.size()) {
+        i = build_eytzinger(sorted, out, i, 2 * k);
+        out[k - 1] = sorted[i++];
+        i = build_eytzinger(sorted, out, i, 2 * k + 1);
+    }
+    return i;
+}
+
+} /* namespace Detail */
+
+/**
+ * Stores the sorted elements of `sorted` in `out` in Eytzinger (breadth first) order.
+ *
+ * In this layout the element at index `k` (counting from one) has its children at `2k` and `2k + 1`,
+ * so the first levels of every search share the same few cache lines and the following
+ * levels can be prefetched. `out` must have the same size as `sorted`.
+ */
+template<typename T>
+constexpr void eytzinger_layout(Slice<const T> sorted, Slice<T> out) {
+    VERIFY(sorted.size() == out.size());
+    Detail::build_eytzinger(sorted, out, 0, 1);
+}
+
+/**
+ * Returns the index into the Eytzinger `layout` of the first element not less than `value`.
+ * Returns an empty `Option` if every element is less than `value`.
+ */
+template<typename T, typename U, typename Compare = Less>
+Option<usize> eytzinger_lower_bound(Slice<T> layout, const U& value, Compare comp = {}) {
+    /*
+     * number of elements in one cache line; the descendants of k that are log2(prefetch_stride) levels
+     * down are the prefetch_stride consecutive nodes starting at k * prefetch_stride, i.e. one line
+     */
+    constexpr usize prefetch_stride = cache_line_size / sizeof(T) > 0 ? cache_line_size / sizeof(T) : 1;
+
+    const T* data = layout.data();
+    usize size = layout.size();
+    usize k = 1;
+
+    while (k <= size) {
+        __builtin_prefetch(data + min(k * prefetch_stride, size) - 1);
+        k = 2 * k + comp(data[k - 1], value);
+    }
+
+    /* strip the trailing right turns (ones) and the final left turn to get back to the answer */
+    k >>= count_trailing_zeros(~k) + 1;
+
+    if (k == 0) {
+        return {};
+    }
+
+    return k - 1;
+}
+
+} /* namespace yt */
+
+using yt::binary_search;
+using yt::branchless_lower_bound;
+using yt::equal_range;
+using yt::eytzinger_layout;
+using yt::eytzinger_lower_bound;
+using yt::IteratorRange;
+using yt::lower_bound;
+using yt::upper_bound;
\ No newline at end of file
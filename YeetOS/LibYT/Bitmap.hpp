@@ -0,0 +1,406 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <New.hpp>
+#include <Types.hpp>
+#include <Array.hpp>
+#include <Atomic.hpp>
+#include <Option.hpp>
+#include <Verify.hpp>
+#include <Utility.hpp>
+#include <Builtins.hpp>
+#include <Platform.hpp>
+
+namespace yt {
+
+namespace Detail {
+
+/**
+ * Common operations of all bitmap types.
+ *
+ * All searches work on whole machine words and use `count_trailing_zeros` to locate
+ * the bit inside a word, so scanning costs one iteration per word instead of one per bit.
+ * Bits past `size()` in the last word are always kept clear.
+ *
+ * `Derived` has to provide `words()` and `size()`.
+ */
+template<typename Derived>
+class BitmapBase {
+
+public:
+    using WordType = usize;
+
+    static constexpr usize bits_per_word = sizeof(WordType) * char_bits;
+
+    /**
+     * Returns the number of words needed to store `bits` bits.
+     */
+    static constexpr usize word_count(usize bits) noexcept {
+        return (bits + bits_per_word - 1) / bits_per_word;
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr bool get(usize index) const noexcept {
+        VERIFY(index < size());
+        return (words()[word_index(index)] & bit_mask(index)) != 0;
+    }
+
+    ALWAYS_INLINE constexpr void set(usize index) noexcept {
+        VERIFY(index < size());
+        words()[word_index(index)] |= bit_mask(index);
+    }
+
+    ALWAYS_INLINE constexpr void clear(usize index) noexcept {
+        VERIFY(index < size());
+        words()[word_index(index)] &= ~bit_mask(index);
+    }
+
+    ALWAYS_INLINE constexpr void set(usize index, bool value) noexcept {
+        if (value) {
+            set(index);
+        } else {
+            clear(index);
+        }
+    }
+
+    /**
+     * Sets or clears `count` bits starting at `start`.
+     */
+    constexpr void set_range(usize start, usize count, bool value) noexcept {
+        VERIFY(start + count <= size());
+
+        WordType* data = words();
+
+        while (count) {
+            usize offset = start % bits_per_word;
+            usize chunk = min(count, bits_per_word - offset);
+            WordType mask = range_mask(offset, chunk);
+
+            if (value) {
+                data[word_index(start)] |= mask;
+            } else {
+                data[word_index(start)] &= ~mask;
+            }
+
+            start += chunk;
+            count -= chunk;
+        }
+    }
+
+    /**
+     * Sets or clears all bits.
+     */
+    constexpr void fill(bool value) noexcept {
+        set_range(0, size(), value);
+    }
+
+    /**
+     * Returns the number of set bits.
+     */
+    NODISCARD constexpr usize count_set() const noexcept {
+        usize count = 0;
+        for (usize i = 0; i < word_count(size()); i++) {
+            count += popcount(words()[i] & valid_mask(i));
+        }
+        return count;
+    }
+
+    /**
+     * Returns the index of the first set bit at or after `start`.
+     */
+    NODISCARD constexpr Option<usize> find_first_set(usize start = 0) const noexcept {
+        return find_first<true>(start);
+    }
+
+    /**
+     * Returns the index of the first clear bit at or after `start`.
+     */
+    NODISCARD constexpr Option<usize> find_first_clear(usize start = 0) const noexcept {
+        return find_first<false>(start);
+    }
+
+    /**
+     * Returns the index of the first run of at least `count` consecutive clear bits at or after `start`.
+     *
+     * Alternates between searching for the next clear and the next set bit, so each
+     * candidate run is measured with word scans as well.
+     */
+    NODISCARD constexpr Option<usize> find_clear_run(usize count, usize start = 0) const noexcept {
+        VERIFY(count > 0);
+
+        while (start < size()) {
+            auto run_start = find_first_clear(start);
+            if (!run_start.has_value()) {
+                return {};
+            }
+
+            auto run_end = find_first_set(*run_start);
+            usize end = run_end.has_value() ? *run_end : size();
+
+            if (end - *run_start >= count) {
+                return *run_start;
+            }
+
+            start = end;
+        }
+
+        return {};
+    }
+
+    /**
+     * Atomically sets the bit at `index` and returns its previous value.
+     */
+    ALWAYS_INLINE bool atomic_set(usize index, MemoryOrder order = MemoryOrder::AcqRel) noexcept {
+        VERIFY(index < size());
+        WordType mask = bit_mask(index);
+        return (__atomic_fetch_or(&words()[word_index(index)], mask, order) & mask) != 0;
+    }
+
+    /**
+     * Atomically clears the bit at `index` and returns its previous value.
+     */
+    ALWAYS_INLINE bool atomic_clear(usize index, MemoryOrder order = MemoryOrder::AcqRel) noexcept {
+        VERIFY(index < size());
+        WordType mask = bit_mask(index);
+        return (__atomic_fetch_and(&words()[word_index(index)], ~mask, order) & mask) != 0;
+    }
+
+    NODISCARD ALWAYS_INLINE bool atomic_get(usize index, MemoryOrder order = MemoryOrder::Acquire) const noexcept {
+        VERIFY(index < size());
+        return (__atomic_load_n(&words()[word_index(index)], order) & bit_mask(index)) != 0;
+    }
+
+    /**
+     * Atomically finds a clear bit at or after `start`, sets it and returns its index.
+     * Returns an empty `Option` if every bit is set.
+     */
+    NODISCARD Option<usize> atomic_find_and_set_first_clear(usize start = 0,
+                                                            MemoryOrder order = MemoryOrder::AcqRel) noexcept {
+        WordType* data = words();
+
+        for (usize i = word_index(start); i < word_count(size()); i++) {
+            WordType word = __atomic_load_n(&data[i], MemoryOrder::Relaxed);
+
+            while (true) {
+                WordType candidates = ~word & valid_mask(i);
+                if (i == word_index(start)) {
+                    candidates &= ~WordType(0) << (start % bits_per_word);
+                }
+
+                if (candidates == 0) {
+                    break;
+                }
+
+                WordType mask = candidates & -candidates;
+                if (__atomic_compare_exchange_n(&data[i], &word, word | mask, false, order, MemoryOrder::Relaxed)) {
+                    return i * bits_per_word + count_trailing_zeros(mask);
+                }
+            }
+        }
+
+        return {};
+    }
+
+protected:
+    static ALWAYS_INLINE constexpr usize word_index(usize index) noexcept {
+        return index / bits_per_word;
+    }
+
+    static ALWAYS_INLINE constexpr WordType bit_mask(usize index) noexcept {
+        return WordType(1) << (index % bits_per_word);
+    }
+
+    /**
+     * Returns a mask of `count` bits starting at bit `offset`.
+     */
+    static ALWAYS_INLINE constexpr WordType range_mask(usize offset, usize count) noexcept {
+        WordType mask = count == bits_per_word ? ~WordType(0) : (WordType(1) << count) - 1;
+        return mask << offset;
+    }
+
+    /**
+     * Returns the mask of bits in word `word` that are inside the bitmap.
+     */
+    ALWAYS_INLINE constexpr WordType valid_mask(usize word) const noexcept {
+        usize remaining = size() - word * bits_per_word;
+        return remaining >= bits_per_word ? ~WordType(0) : range_mask(0, remaining);
+    }
+
+private:
+    template<bool Value>
+    constexpr Option<usize> find_first(usize start) const noexcept {
+        const WordType* data = words();
+
+        for (usize i = word_index(start); i < word_count(size()); i++) {
+            WordType word = (Value ? data[i] : ~data[i]) & valid_mask(i);
+
+            if (i == word_index(start)) {
+                word &= ~WordType(0) << (start % bits_per_word);
+            }
+
+            if (word != 0) {
+                return i * bits_per_word + count_trailing_zeros(word);
+            }
+        }
+
+        return {};
+    }
+
+    ALWAYS_INLINE constexpr WordType* words() noexcept {
+        return static_cast<Derived*>(this)->words();
+    }
+
+    ALWAYS_INLINE constexpr const WordType* words() const noexcept {
+        return static_cast<const Derived*>(this)->words();
+    }
+
+    ALWAYS_INLINE constexpr usize size() const noexcept {
+        return static_cast<const Derived*>(this)->size();
+    }
+};
+
+} /* namespace Detail */
+
+/**
+ * A non-owning bitmap over existing storage, e.g. memory handed out during early boot.
+ */
+class BitmapView : public Detail::BitmapBase<BitmapView> {
+
+public:
+    ALWAYS_INLINE constexpr BitmapView() noexcept = default;
+
+    /**
+     * `data` must hold at least `word_count(bits)` words.
+     */
+    ALWAYS_INLINE constexpr BitmapView(WordType* data, usize bits) noexcept : m_words(data), m_size(bits) {}
+
+    NODISCARD ALWAYS_INLINE constexpr usize size() const noexcept {
+        return m_size;
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr WordType* words() noexcept {
+        return m_words;
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr const WordType* words() const noexcept {
+        return m_words;
+    }
+
+private:
+    WordType* m_words { nullptr };
+    usize m_size { 0 };
+};
+
+/**
+ * A bitmap with a fixed number of bits stored inline.
+ *
+ * @tparam N Number of bits
+ */
+template<usize N>
+class Bitmap : public Detail::BitmapBase<Bitmap<N>> {
+
+    using Base = Detail::BitmapBase<Bitmap<N>>;
+
+public:
+    using typename Base::WordType;
+
+    ALWAYS_INLINE constexpr Bitmap() noexcept = default;
+
+    NODISCARD ALWAYS_INLINE constexpr usize size() const noexcept {
+        return N;
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr WordType* words() noexcept {
+        return m_words.data();
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr const WordType* words() const noexcept {
+        return m_words.data();
+    }
+
+private:
+    Array<WordType, Base::word_count(N)> m_words {};
+};
+
+/**
+ * A bitmap whose size is chosen at runtime and whose storage lives on the heap.
+ */
+class DynamicBitmap : public Detail::BitmapBase<DynamicBitmap> {
+    NOT_COPYABLE(DynamicBitmap);
+
+public:
+    ALWAYS_INLINE DynamicBitmap() noexcept = default;
+
+    DynamicBitmap(usize bits, bool value = false) : m_size(bits) {
+        m_words = static_cast<WordType*>(::operator new(word_count(bits) * sizeof(WordType)));
+
+        for (usize i = 0; i < word_count(bits); i++) {
+            m_words[i] = 0;
+        }
+
+        if (value) {
+            fill(true);
+        }
+    }
+
+    ALWAYS_INLINE DynamicBitmap(DynamicBitmap&& other) noexcept :
+        m_words(exchange(other.m_words, nullptr)), m_size(exchange(other.m_size, 0u)) {}
+
+    DynamicBitmap& operator=(DynamicBitmap&& other) noexcept {
+        DynamicBitmap temp(move(other));
+        ::swap(m_words, temp.m_words);
+        ::swap(m_size, temp.m_size);
+        return *this;
+    }
+
+    ~DynamicBitmap() {
+        if (m_words) {
+            ::operator delete(m_words, word_count(m_size) * sizeof(WordType));
+        }
+    }
+
+    NODISCARD ALWAYS_INLINE usize size() const noexcept {
+        return m_size;
+    }
+
+    NODISCARD ALWAYS_INLINE WordType* words() noexcept {
+        return m_words;
+    }
+
+    NODISCARD ALWAYS_INLINE const WordType* words() const noexcept {
+        return m_words;
+    }
+
+private:
+    WordType* m_words { nullptr };
+    usize m_size { 0 };
+};
+
+} /* namespace yt */
+
+using yt::Bitmap;
+using yt::BitmapView;
+using yt::DynamicBitmap;
\ No newline at end of file
@@ -0,0 +1,373 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <New.hpp>
+#include <Types.hpp>
+#include <OwnPtr.hpp>
+#include <Option.hpp>
+#include <Traits.hpp>
+#include <Verify.hpp>
+#include <Utility.hpp>
+#include <Concepts.hpp>
+#include <Platform.hpp>
+
+namespace yt {
+
+/**
+ * Error types whose codes are exactly `0` to `count - 1` can specialize this with their `count`.
+ * `ErrorOr` then stores them in the niche of the value instead of next to it.
+ */
+template<typename E>
+struct ErrorCodeRange {
+    static constexpr usize count = 0;
+};
+
+class Error;
+
+/* the codes of Libc/errno.h, 0 up to ELAST (checked in Libc/errno.cpp) */
+template<>
+struct ErrorCodeRange<Error> {
+    static constexpr usize count = 87;
+};
+
+/**
+ * An errno style error code, see Libc/errno.h for the possible values.
+ */
+class Error {
+
+public:
+    ALWAYS_INLINE constexpr explicit Error(int code) noexcept : m_code(code) {
+        VERIFY(0 <= code && static_cast<usize>(code) < ErrorCodeRange<Error>::count);
+    }
+
+    NODISCARD ALWAYS_INLINE static constexpr Error from_code(int code) noexcept {
+        return Error(code);
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr int code() const noexcept {
+        return m_code;
+    }
+
+    constexpr bool operator==(const Error&) const noexcept = default;
+
+private:
+    int m_code;
+};
+
+namespace Detail {
+
+/**
+ * Niche index 0 is left to the value itself (e.g. a moved-from `OnwPtr` is null, which is niche 0),
+ * error codes start at 1. Packing is only used if every code of `E` fits.
+ */
+template<typename T, typename E>
+concept NichePackableError = (is_enum<E> || SameAs<E, Error>) && ErrorCodeRange<E>::count > 0 && HasNiche<T>
+                             && ErrorCodeRange<E>::count < NicheTraits<T>::niche_count;
+
+template<typename E>
+ALWAYS_INLINE constexpr usize error_code_of(const E& error) noexcept {
+    if constexpr (is_enum<E>) {
+        return static_cast<usize>(error);
+    } else {
+        return static_cast<usize>(error.code());
+    }
+}
+
+template<typename E>
+ALWAYS_INLINE constexpr E error_from_code(usize code) noexcept {
+    if constexpr (is_enum<E>) {
+        return static_cast<E>(code);
+    } else {
+        return E::from_code(static_cast<int>(code));
+    }
+}
+
+/**
+ * Stores either a `T` or an `E` next to a flag telling which one it is.
+ */
+template<typename T, typename E>
+class ErrorOrStorage {
+
+public:
+    NODISCARD ALWAYS_INLINE bool is_error() const noexcept {
+        return m_is_error;
+    }
+
+    template<typename... Args>
+    ALWAYS_INLINE void init_value(Args&&... args) {
+        new (m_storage) T(forward<Args>(args)...);
+        m_is_error = false;
+    }
+
+    ALWAYS_INLINE void init_error(E error) {
+        new (m_storage) E(move(error));
+        m_is_error = true;
+    }
+
+    ALWAYS_INLINE T* value_ptr() noexcept {
+        return __builtin_launder(reinterpret_cast<T*>(m_storage));
+    }
+
+    ALWAYS_INLINE const T* value_ptr() const noexcept {
+        return __builtin_launder(reinterpret_cast<const T*>(m_storage));
+    }
+
+    ALWAYS_INLINE E& error() noexcept {
+        return *__builtin_launder(reinterpret_cast<E*>(m_storage));
+    }
+
+    ALWAYS_INLINE const E& error() const noexcept {
+        return *__builtin_launder(reinterpret_cast<const E*>(m_storage));
+    }
+
+    ALWAYS_INLINE void destroy() noexcept {
+        if (m_is_error) {
+            error().~E();
+        } else {
+            value_ptr()->~T();
+        }
+    }
+
+private:
+    alignas(T) alignas(E) Byte m_storage[max(sizeof(T), sizeof(E))];
+    bool m_is_error;
+};
+
+/**
+ * Stores the error code in the niche of `T`, so the whole `ErrorOr` is as large as a `T`.
+ */
+template<typename T, typename E>
+requires NichePackableError<T, E>
+class ErrorOrStorage<T, E> {
+
+public:
+    NODISCARD ALWAYS_INLINE bool is_error() const noexcept {
+        /* wraps around for niche index 0, which is not an error */
+        return NicheTraits<T>::niche_index(m_storage) - 1 < ErrorCodeRange<E>::count;
+    }
+
+    template<typename... Args>
+    ALWAYS_INLINE void init_value(Args&&... args) {
+        new (m_storage) T(forward<Args>(args)...);
+    }
+
+    ALWAYS_INLINE void init_error(E error) noexcept {
+        usize code = error_code_of(error);
+        VERIFY(code < ErrorCodeRange<E>::count);
+        NicheTraits<T>::store_niche(m_storage, code + 1);
+    }
+
+    ALWAYS_INLINE T* value_ptr() noexcept {
+        return __builtin_launder(reinterpret_cast<T*>(m_storage));
+    }
+
+    ALWAYS_INLINE const T* value_ptr() const noexcept {
+        return __builtin_launder(reinterpret_cast<const T*>(m_storage));
+    }
+
+    ALWAYS_INLINE E error() const noexcept {
+        return error_from_code<E>(NicheTraits<T>::niche_index(m_storage) - 1);
+    }
+
+    ALWAYS_INLINE void destroy() noexcept {
+        if (!is_error()) {
+            value_ptr()->~T();
+        }
+    }
+
+private:
+    alignas(T) Byte m_storage[sizeof(T)];
+};
+
+} /* namespace Detail */
+
+/**
+ * Holds either a value or the error that prevented producing it.
+ *
+ * Unlike throwing an exception, reporting an expected failure this way only costs a branch
+ * at each level. Use `TRY()` to pass errors on to the caller.
+ * If `T` has a niche (e.g. `OnwPtr`) and `E` has an `ErrorCodeRange` (like `Error`),
+ * the error is encoded in the niche and `ErrorOr<T, E>` is no larger than `T`.
+ *
+ * @tparam T the type of the value.
+ * @tparam E the type of the error, must differ from `T`.
+ */
+template<typename T, typename E = Error>
+class NODISCARD ErrorOr {
+    static_assert(!SameAs<T, E>, "the value and error types must differ");
+
+public:
+    using ValueType = T;
+    using ErrorType = E;
+
+    template<typename U = T>
+    ALWAYS_INLINE ErrorOr(U&& value) requires(!SameAs<remove_cvref<U>, ErrorOr> && !SameAs<remove_cvref<U>, E>
+                                               && ConstructibleFrom<T, U&&>) {
+        m_storage.init_value(forward<U>(value));
+    }
+
+    ALWAYS_INLINE ErrorOr(E error) {
+        m_storage.init_error(move(error));
+    }
+
+    ALWAYS_INLINE ErrorOr(const ErrorOr& other) requires CopyConstructible<T> && CopyConstructible<E> {
+        init_from(other);
+    }
+
+    ALWAYS_INLINE ErrorOr(ErrorOr&& other) requires MoveConstructible<T> && MoveConstructible<E> {
+        init_from(move(other));
+    }
+
+    ErrorOr& operator=(const ErrorOr& other) requires CopyConstructible<T> && CopyConstructible<E> {
+        if (this != &other) {
+            m_storage.destroy();
+            init_from(other);
+        }
+        return *this;
+    }
+
+    ErrorOr& operator=(ErrorOr&& other) requires MoveConstructible<T> && MoveConstructible<E> {
+        if (this != &other) {
+            m_storage.destroy();
+            init_from(move(other));
+        }
+        return *this;
+    }
+
+    ~ErrorOr() {
+        m_storage.destroy();
+    }
+
+    NODISCARD ALWAYS_INLINE bool is_error() const noexcept {
+        return m_storage.is_error();
+    }
+
+    NODISCARD ALWAYS_INLINE T& value() & noexcept {
+        VERIFY(!is_error());
+        return *m_storage.value_ptr();
+    }
+
+    NODISCARD ALWAYS_INLINE const T& value() const& noexcept {
+        VERIFY(!is_error());
+        return *m_storage.value_ptr();
+    }
+
+    NODISCARD ALWAYS_INLINE decltype(auto) error() const noexcept {
+        VERIFY(is_error());
+        return m_storage.error();
+    }
+
+    NODISCARD ALWAYS_INLINE T release_value() noexcept(is_nothrow_move_constructible<T>) {
+        return move(value());
+    }
+
+    NODISCARD ALWAYS_INLINE E release_error() noexcept(is_nothrow_move_constructible<E>) {
+        VERIFY(is_error());
+        return move(m_storage.error());
+    }
+
+private:
+    template<typename Other>
+    ALWAYS_INLINE void init_from(Other&& other) {
+        if constexpr (is_lvalue_reference<Other>) {
+            if (other.is_error()) {
+                m_storage.init_error(other.m_storage.error());
+            } else {
+                m_storage.init_value(*other.m_storage.value_ptr());
+            }
+        } else {
+            if (other.is_error()) {
+                m_storage.init_error(move(other.m_storage.error()));
+            } else {
+                m_storage.init_value(move(*other.m_storage.value_ptr()));
+            }
+        }
+    }
+
+private:
+    Detail::ErrorOrStorage<T, E> m_storage;
+};
+
+static_assert(sizeof(ErrorOr<OnwPtr<int>>) == sizeof(void*));
+static_assert(sizeof(ErrorOr<int*>) == sizeof(void*));
+
+/**
+ * An `ErrorOr` for operations that produce no value.
+ */
+template<typename E>
+class NODISCARD ErrorOr<void, E> {
+
+public:
+    using ValueType = void;
+    using ErrorType = E;
+
+    ALWAYS_INLINE ErrorOr() noexcept = default;
+
+    ALWAYS_INLINE ErrorOr(E error) : m_error(move(error)) {}
+
+    NODISCARD ALWAYS_INLINE bool is_error() const noexcept {
+        return m_error.has_value();
+    }
+
+    ALWAYS_INLINE void value() const noexcept {
+        VERIFY(!is_error());
+    }
+
+    NODISCARD ALWAYS_INLINE const E& error() const noexcept {
+        return m_error.value();
+    }
+
+    ALWAYS_INLINE void release_value() noexcept {
+        value();
+    }
+
+    NODISCARD ALWAYS_INLINE E release_error() noexcept(is_nothrow_move_constructible<E>) {
+        return m_error.release();
+    }
+
+private:
+    Option<E> m_error;
+};
+
+} /* namespace yt */
+
+/**
+ * Evaluates an `ErrorOr` expression and returns its error from the current function,
+ * otherwise the whole `TRY()` evaluates to the released value.
+ */
+#define TRY(expression)                                                                                                \
+    ({                                                                                                                 \
+        auto&& _try_result = (expression);                                                                             \
+        if (_try_result.is_error()) [[unlikely]] {                                                                     \
+            return _try_result.release_error();                                                                        \
+        }                                                                                                              \
+        _try_result.release_value();                                                                                   \
+    })
+
+using yt::Error;
+using yt::ErrorCodeRange;
+using yt::ErrorOr;
\ No newline at end of file
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <string.h>
+
+#include <Format.hpp>
+#include <Utility.hpp>
+#include <IntegerFormatting.hpp>
+
+namespace yt {
+
+void FormatBuilder::append(StringView view) {
+    const char* chars = view.characters();
+    usize length = view.length();
+
+    m_total += length;
+
+    /* large pieces bypass the buffer */
+    if (length >= buffer_size) {
+        flush();
+        m_flush_function(m_context, view);
+        return;
+    }
+
+    if (m_used + length > buffer_size)
+        flush();
+
+    memcpy(m_buffer + m_used, chars, length);
+    m_used += length;
+}
+
+void FormatBuilder::append_repeated(char c, usize count) {
+    while (count) {
+        if (m_used == buffer_size)
+            flush();
+
+        usize chunk = min(count, buffer_size - m_used);
+        memset(m_buffer + m_used, c, chunk);
+        m_used += chunk;
+        m_total += chunk;
+        count -= chunk;
+    }
+}
+
+void FormatBuilder::append_padded(StringView prefix, StringView body, const FormatSpec& spec, FormatAlign default_align) {
+    usize length = prefix.length() + body.length();
+    usize padding = spec.width > length ? spec.width - length : 0;
+
+    if (spec.zero_pad && spec.align == FormatAlign::Default) {
+        append(prefix);
+        append_repeated('0', padding);
+        append(body);
+        return;
+    }
+
+    FormatAlign align = spec.align == FormatAlign::Default ? default_align : spec.align;
+
+    usize before = 0;
+    if (align == FormatAlign::Right) {
+        before = padding;
+    } else if (align == FormatAlign::Center) {
+        before = padding / 2;
+    }
+
+    append_repeated(spec.fill, before);
+    append(prefix);
+    append(body);
+    append_repeated(spec.fill, padding - before);
+}
+
+void FormatBuilder::flush() {
+    if (m_used) {
+        m_flush_function(m_context, StringView(m_buffer, m_used));
+        m_used = 0;
+    }
+}
+
+namespace Detail {
+
+void format_integer(FormatBuilder& builder, const FormatSpec& spec, u64 magnitude, bool negative) {
+    u32 base = 10;
+    bool uppercase = false;
+    const char* radix_prefix = "";
+
+    switch (spec.type) {
+    case 'x':
+        base = 16;
+        radix_prefix = "0x";
+        break;
+    case 'X':
+        base = 16;
+        uppercase = true;
+        radix_prefix = "0X";
+        break;
+    case 'b':
+        base = 2;
+        radix_prefix = "0b";
+        break;
+    case 'o':
+        base = 8;
+        radix_prefix = "0o";
+        break;
+    }
+
+    char digits[max_integer_digits];
+    char* end = digits + sizeof(digits);
+    char* start = yt::format_unsigned(end, magnitude, base, uppercase);
+
+    char prefix[3];
+    usize prefix_length = 0;
+
+    if (negative)
+        prefix[prefix_length++] = '-';
+
+    if (spec.alternate) {
+        for (const char* p = radix_prefix; *p; p++) {
+            prefix[prefix_length++] = *p;
+        }
+    }
+
+    builder.append_padded(StringView(prefix, prefix_length), StringView(start, end - start), spec, FormatAlign::Right);
+}
+
+} /* namespace Detail */
+
+} /* namespace yt */
@@ -0,0 +1,412 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Types.hpp>
+#include <String.hpp>
+#include <Platform.hpp>
+#include <Concepts.hpp>
+#include <TypeMagic.hpp>
+#include <StringView.hpp>
+
+namespace yt {
+
+enum class FormatAlign : u8 {
+    Default,
+    Left,
+    Right,
+    Center,
+};
+
+/**
+ * A parsed replacement field, `{:[[fill]align][#][0][width][type]}`.
+ */
+struct FormatSpec {
+    char fill = ' ';
+    FormatAlign align = FormatAlign::Default;
+    bool alternate = false;
+    bool zero_pad = false;
+    u16 width = 0;
+    char type = '\0';
+};
+
+/**
+ * Buffers formatted output and passes it on in chunks to a flush function.
+ */
+class FormatBuilder {
+    NOT_COPYABLE(FormatBuilder);
+    NOT_MOVABLE(FormatBuilder);
+
+public:
+    using FlushFunction = void (*)(void* context, StringView chunk);
+
+    FormatBuilder(FlushFunction flush_function, void* context) noexcept :
+        m_flush_function(flush_function), m_context(context) {}
+
+    ~FormatBuilder() {
+        flush();
+    }
+
+    ALWAYS_INLINE void append(char c) {
+        if (m_used == buffer_size)
+            flush();
+        m_buffer[m_used++] = c;
+        m_total++;
+    }
+
+    void append(StringView view);
+
+    void append_repeated(char c, usize count);
+
+    /**
+     * Appends `prefix` and `body` padded to `spec.width`. With zero padding the zeros go between the two.
+     */
+    void append_padded(StringView prefix, StringView body, const FormatSpec& spec, FormatAlign default_align);
+
+    void flush();
+
+    NODISCARD usize total() const noexcept {
+        return m_total;
+    }
+
+private:
+    static constexpr usize buffer_size = 128;
+
+    char m_buffer[buffer_size];
+    usize m_used = 0;
+    usize m_total = 0;
+    FlushFunction m_flush_function;
+    void* m_context;
+};
+
+/**
+ * Formats values of type `T`. Every specialization provides
+ *  - `static consteval bool supports(char type)`, which decides at compile time if a presentation type is valid for `T`
+ *  - `static void format(FormatBuilder&, const FormatSpec&, const T&)`
+ */
+template<typename T>
+struct Formatter;
+
+namespace Detail {
+
+void format_integer(FormatBuilder& builder, const FormatSpec& spec, u64 magnitude, bool negative);
+
+/* Not defined on purpose: reaching it during constant evaluation turns `reason` into a compile error. */
+void format_string_error(const char* reason);
+
+consteval bool is_integer_format_type(char type) {
+    return type == '\0' || type == 'd' || type == 'x' || type == 'X' || type == 'b' || type == 'o' || type == 'c';
+}
+
+template<typename T>
+struct ArgumentFormatter {
+    using Type = Formatter<remove_cvref<T>>;
+};
+
+} /* namespace Detail */
+
+template<Integral T>
+struct Formatter<T> {
+    static consteval bool supports(char type) {
+        return Detail::is_integer_format_type(type);
+    }
+
+    static void format(FormatBuilder& builder, const FormatSpec& spec, T value) {
+        if (spec.type == 'c') {
+            char c = static_cast<char>(value);
+            builder.append_padded({}, StringView(&c, 1), spec, FormatAlign::Left);
+        } else if constexpr (is_signed<T>) {
+            u64 magnitude = value < 0 ? -static_cast<u64>(value) : static_cast<u64>(value);
+            Detail::format_integer(builder, spec, magnitude, value < 0);
+        } else {
+            Detail::format_integer(builder, spec, value, false);
+        }
+    }
+};
+
+template<>
+struct Formatter<char> {
+    static consteval bool supports(char type) {
+        return Detail::is_integer_format_type(type);
+    }
+
+    static void format(FormatBuilder& builder, const FormatSpec& spec, char value) {
+        if (spec.type == '\0' || spec.type == 'c') {
+            builder.append_padded({}, StringView(&value, 1), spec, FormatAlign::Left);
+        } else {
+            Detail::format_integer(builder, spec, static_cast<unsigned char>(value), false);
+        }
+    }
+};
+
+template<>
+struct Formatter<bool> {
+    static consteval bool supports(char type) {
+        return type == '\0' || type == 's';
+    }
+
+    static void format(FormatBuilder& builder, const FormatSpec& spec, bool value) {
+        builder.append_padded({}, value ? "true" : "false", spec, FormatAlign::Left);
+    }
+};
+
+template<>
+struct Formatter<StringView> {
+    static consteval bool supports(char type) {
+        return type == '\0' || type == 's';
+    }
+
+    static void format(FormatBuilder& builder, const FormatSpec& spec, StringView value) {
+        builder.append_padded({}, value, spec, FormatAlign::Left);
+    }
+};
+
+template<>
+struct Formatter<String> : Formatter<StringView> {};
+
+template<>
+struct Formatter<const char*> : Formatter<StringView> {};
+
+template<>
+struct Formatter<char*> : Formatter<StringView> {};
+
+template<usize N>
+struct Formatter<char[N]> : Formatter<StringView> {};
+
+template<typename T>
+struct Formatter<T*> {
+    static consteval bool supports(char type) {
+        return type == '\0' || type == 'p';
+    }
+
+    static void format(FormatBuilder& builder, const FormatSpec& spec, const T* value) {
+        FormatSpec hex_spec = spec;
+        hex_spec.type = 'x';
+        hex_spec.alternate = true;
+        Detail::format_integer(builder, hex_spec, reinterpret_cast<FlatPtr>(value), false);
+    }
+};
+
+/**
+ * A format string checked and parsed during compilation.
+ *
+ * Replacement fields are `{}` or `{:spec}` and are matched to the arguments in order, `{{` and `}}` are literal braces.
+ * A wrong number of fields or a presentation type that the argument's Formatter does not support fails to compile.
+ * At runtime only the literal text between the fields and the pre-parsed specs are used.
+ */
+template<typename... Args>
+class FormatString {
+
+    struct Field {
+        u16 literal_start = 0;
+        u16 literal_length = 0;
+        bool literal_has_escapes = false;
+        FormatSpec spec;
+    };
+
+    static constexpr usize field_count = sizeof...(Args);
+
+public:
+    template<usize N>
+    consteval FormatString(const char (&string)[N]) : m_string(string) {
+        static_assert(N - 1 <= static_cast<u16>(-1), "format string is too long");
+        parse(N - 1);
+        check_types();
+    }
+
+    template<typename... Values>
+    void format(FormatBuilder& builder, const Values&... values) const {
+        usize index = 0;
+        (format_field(builder, index++, values), ...);
+        append_literal(builder, m_fields[field_count]);
+    }
+
+private:
+    consteval void parse(usize length) {
+        usize field = 0;
+        usize literal_start = 0;
+        bool has_escapes = false;
+
+        for (usize i = 0; i < length; i++) {
+            char c = m_string[i];
+
+            if (c == '}') {
+                if (i + 1 < length && m_string[i + 1] == '}') {
+                    has_escapes = true;
+                    i++;
+                    continue;
+                }
+                Detail::format_string_error("unmatched '}' in format string");
+            }
+
+            if (c != '{')
+                continue;
+
+            if (i + 1 < length && m_string[i + 1] == '{') {
+                has_escapes = true;
+                i++;
+                continue;
+            }
+
+            if (field == field_count)
+                Detail::format_string_error("more replacement fields than arguments");
+
+            m_fields[field].literal_start = literal_start;
+            m_fields[field].literal_length = i - literal_start;
+            m_fields[field].literal_has_escapes = has_escapes;
+
+            i = parse_spec(i + 1, length, m_fields[field].spec);
+
+            literal_start = i + 1;
+            has_escapes = false;
+            field++;
+        }
+
+        if (field != field_count)
+            Detail::format_string_error("fewer replacement fields than arguments");
+
+        m_fields[field_count].literal_start = literal_start;
+        m_fields[field_count].literal_length = length - literal_start;
+        m_fields[field_count].literal_has_escapes = has_escapes;
+    }
+
+    /* parses the field starting after its '{' and returns the index of the closing '}' */
+    consteval usize parse_spec(usize i, usize length, FormatSpec& spec) {
+        auto at = [&](usize index) { return index < length ? m_string[index] : '\0'; };
+        auto align_of = [](char c) {
+            switch (c) {
+            case '<':
+                return FormatAlign::Left;
+            case '>':
+                return FormatAlign::Right;
+            case '^':
+                return FormatAlign::Center;
+            default:
+                return FormatAlign::Default;
+            }
+        };
+
+        if (at(i) == '}')
+            return i;
+
+        if (at(i) != ':')
+            Detail::format_string_error("expected ':' or '}' in replacement field");
+        i++;
+
+        if (at(i) != '\0' && at(i) != '}' && align_of(at(i + 1)) != FormatAlign::Default) {
+            spec.fill = at(i);
+            spec.align = align_of(at(i + 1));
+            i += 2;
+        } else if (align_of(at(i)) != FormatAlign::Default) {
+            spec.align = align_of(at(i));
+            i++;
+        }
+
+        if (at(i) == '#') {
+            spec.alternate = true;
+            i++;
+        }
+
+        if (at(i) == '0') {
+            spec.zero_pad = true;
+            i++;
+        }
+
+        for (; at(i) >= '0' && at(i) <= '9'; i++) {
+            spec.width = spec.width * 10 + (at(i) - '0');
+        }
+
+        if (at(i) != '}' && at(i) != '\0') {
+            spec.type = at(i);
+            i++;
+        }
+
+        if (at(i) != '}')
+            Detail::format_string_error("unterminated replacement field");
+
+        return i;
+    }
+
+    consteval void check_types() {
+        usize index = 0;
+        bool supported = (Detail::ArgumentFormatter<Args>::Type::supports(m_fields[index++].spec.type) && ...);
+        if (!supported)
+            Detail::format_string_error("presentation type is not supported for the argument");
+    }
+
+    template<typename T>
+    ALWAYS_INLINE void format_field(FormatBuilder& builder, usize index, const T& value) const {
+        append_literal(builder, m_fields[index]);
+        Detail::ArgumentFormatter<T>::Type::format(builder, m_fields[index].spec, value);
+    }
+
+    ALWAYS_INLINE void append_literal(FormatBuilder& builder, const Field& field) const {
+        StringView literal(m_string + field.literal_start, field.literal_length);
+
+        if (!field.literal_has_escapes) {
+            builder.append(literal);
+            return;
+        }
+
+        for (usize i = 0; i < literal.length(); i++) {
+            builder.append(literal[i]);
+            if (literal[i] == '{' || literal[i] == '}')
+                i++;
+        }
+    }
+
+    const char* m_string;
+    Field m_fields[field_count + 1] {};
+};
+
+/**
+ * Formats `args` according to `fmt` into `builder`.
+ */
+template<typename... Args>
+void format_to(FormatBuilder& builder, FormatString<typename TypeIdentity<Args>::Type...> fmt, const Args&... args) {
+    fmt.format(builder, args...);
+}
+
+/**
+ * Formats `args` according to `fmt` into a new String.
+ */
+template<typename... Args>
+NODISCARD String format(FormatString<typename TypeIdentity<Args>::Type...> fmt, const Args&... args) {
+    String result;
+    FormatBuilder builder([](void* context, StringView chunk) { static_cast<String*>(context)->append(chunk); },
+                          &result);
+    fmt.format(builder, args...);
+    builder.flush();
+    return result;
+}
+
+} /* namespace yt */
+
+using yt::format;
+using yt::format_to;
+using yt::FormatBuilder;
+using yt::FormatString;
+using yt::Formatter;
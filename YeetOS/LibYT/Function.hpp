@@ -0,0 +1,291 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <New.hpp>
+#include <Types.hpp>
+#include <Invoke.hpp>
+#include <Verify.hpp>
+#include <Utility.hpp>
+#include <Concepts.hpp>
+#include <Platform.hpp>
+#include <TypeMagic.hpp>
+
+namespace yt {
+
+namespace Detail {
+
+template<typename F, typename R, typename... Args>
+concept InvocableAs = is_invocable<F&, Args...> && (is_void<R> || is_convertible<invoke_result<F&, Args...>, R>);
+
+template<typename R, typename F, typename... Args>
+ALWAYS_INLINE R invoke_as(F& f, Args&&... args) {
+    if constexpr (is_void<R>) {
+        invoke(f, forward<Args>(args)...);
+    } else {
+        return invoke(f, forward<Args>(args)...);
+    }
+}
+
+} /* namespace Detail */
+
+template<typename Signature>
+class Function;
+
+/**
+ * An owning, move-only wrapper around any callable with the signature `R(Args...)`.
+ *
+ * Callables of up to `inline_capacity` bytes that can be moved without throwing live inside
+ * the `Function` itself, so wrapping a typical lambda does not allocate. Larger ones are
+ * moved to the heap. Trivially copyable callables are relocated with a plain memcpy.
+ */
+template<typename R, typename... Args>
+class Function<R(Args...)> {
+    NOT_COPYABLE(Function);
+
+public:
+    static constexpr usize inline_capacity = 4 * sizeof(void*);
+    static constexpr usize inline_alignment = 2 * alignof(void*);
+
+    ALWAYS_INLINE Function() noexcept = default;
+
+    ALWAYS_INLINE Function(nullptr_t) noexcept {}
+
+    template<typename F>
+    requires(!SameAs<remove_cvref<F>, Function> && Detail::InvocableAs<decay<F>, R, Args...>)
+    Function(F&& f) {
+        init(forward<F>(f));
+    }
+
+    ALWAYS_INLINE Function(Function&& other) noexcept {
+        move_from(other);
+    }
+
+    Function& operator=(Function&& other) noexcept {
+        if (this != &other) {
+            clear();
+            move_from(other);
+        }
+        return *this;
+    }
+
+    template<typename F>
+    requires(!SameAs<remove_cvref<F>, Function> && Detail::InvocableAs<decay<F>, R, Args...>)
+    Function& operator=(F&& f) {
+        clear();
+        init(forward<F>(f));
+        return *this;
+    }
+
+    ALWAYS_INLINE Function& operator=(nullptr_t) noexcept {
+        clear();
+        return *this;
+    }
+
+    ~Function() {
+        clear();
+    }
+
+    /**
+     * Calls the stored callable. Like a plain function pointer, calling does not count as
+     * modifying the `Function`, even if the callable itself has mutable state.
+     */
+    ALWAYS_INLINE R operator()(Args... args) const {
+        VERIFY(m_invoke);
+        return m_invoke(const_cast<Byte*>(m_storage), forward<Args>(args)...);
+    }
+
+    NODISCARD ALWAYS_INLINE bool is_null() const noexcept {
+        return m_invoke == nullptr;
+    }
+
+    ALWAYS_INLINE explicit operator bool() const noexcept {
+        return m_invoke != nullptr;
+    }
+
+    void clear() noexcept {
+        if (m_manage) {
+            m_manage(Operation::Destroy, nullptr, m_storage);
+        }
+
+        m_invoke = nullptr;
+        m_manage = nullptr;
+    }
+
+private:
+    enum class Operation {
+        Move,
+        Destroy,
+    };
+
+    using InvokeFunc = R (*)(void*, Args&&...);
+    using ManageFunc = void (*)(Operation, void*, void*);
+
+    template<typename F>
+    static constexpr bool fits_inline = sizeof(F) <= inline_capacity && alignof(F) <= inline_alignment &&
+                                        is_nothrow_move_constructible<F>;
+
+    template<typename F>
+    static R invoke_inline(void* storage, Args&&... args) {
+        return Detail::invoke_as<R>(*static_cast<F*>(storage), forward<Args>(args)...);
+    }
+
+    template<typename F>
+    static R invoke_heap(void* storage, Args&&... args) {
+        return Detail::invoke_as<R>(**static_cast<F**>(storage), forward<Args>(args)...);
+    }
+
+    template<typename F>
+    static void manage_inline(Operation op, void* dest, void* src) {
+        F* f = static_cast<F*>(src);
+
+        if (op == Operation::Move) {
+            new (dest) F(move(*f));
+        }
+
+        f->~F();
+    }
+
+    template<typename F>
+    static void manage_heap(Operation op, void* dest, void* src) {
+        F* f = *static_cast<F**>(src);
+
+        if (op == Operation::Move) {
+            new (dest) F*(f);
+        } else {
+            delete f;
+        }
+    }
+
+    template<typename F>
+    void init(F&& f) {
+        using Fn = decay<F>;
+
+        if constexpr (is_pointer<Fn> || is_member_pointer<Fn>) {
+            if (!f) {
+                return;
+            }
+        }
+
+        if constexpr (fits_inline<Fn>) {
+            new (m_storage) Fn(forward<F>(f));
+            m_invoke = &invoke_inline<Fn>;
+            m_manage = is_trivially_copyable<Fn> ? nullptr : &manage_inline<Fn>;
+        } else {
+            new (m_storage) Fn*(new Fn(forward<F>(f)));
+            m_invoke = &invoke_heap<Fn>;
+            m_manage = &manage_heap<Fn>;
+        }
+    }
+
+    ALWAYS_INLINE void move_from(Function& other) noexcept {
+        if (!other.m_invoke) {
+            return;
+        }
+
+        if (other.m_manage) {
+            other.m_manage(Operation::Move, m_storage, other.m_storage);
+        } else {
+            __builtin_memcpy(m_storage, other.m_storage, inline_capacity);
+        }
+
+        m_invoke = exchange(other.m_invoke, nullptr);
+        m_manage = exchange(other.m_manage, nullptr);
+    }
+
+private:
+    InvokeFunc m_invoke { nullptr };
+    ManageFunc m_manage { nullptr };
+    alignas(inline_alignment) Byte m_storage[inline_capacity];
+};
+
+template<typename Signature>
+class FunctionRef;
+
+/**
+ * A non-owning reference to a callable with the signature `R(Args...)`.
+ *
+ * It is two pointers wide and never allocates, which makes it the cheapest way to pass
+ * a callback down the stack. The referenced callable has to outlive the `FunctionRef`.
+ */
+template<typename R, typename... Args>
+class FunctionRef<R(Args...)> {
+
+public:
+    FunctionRef() = delete;
+
+    template<typename F>
+    requires(!SameAs<remove_cvref<F>, FunctionRef> && Detail::InvocableAs<remove_reference<F>, R, Args...>)
+    ALWAYS_INLINE FunctionRef(F&& f) noexcept {
+        using Fn = remove_reference<F>;
+
+        if constexpr (is_function<Fn>) {
+            m_callee.function = reinterpret_cast<void (*)()>(&f);
+            m_invoke = &invoke_function<Fn*>;
+        } else if constexpr (is_pointer<remove_cv<Fn>> && is_function<remove_pointer<Fn>>) {
+            VERIFY(f);
+            m_callee.function = reinterpret_cast<void (*)()>(f);
+            m_invoke = &invoke_function<remove_cv<Fn>>;
+        } else {
+            m_callee.object = const_cast<void*>(static_cast<const void*>(addr_of(f)));
+            m_invoke = &invoke_object<Fn>;
+        }
+    }
+
+    ALWAYS_INLINE FunctionRef(const FunctionRef&) noexcept = default;
+    ALWAYS_INLINE FunctionRef& operator=(const FunctionRef&) noexcept = default;
+
+    ALWAYS_INLINE R operator()(Args... args) const {
+        return m_invoke(m_callee, forward<Args>(args)...);
+    }
+
+private:
+    union Callee {
+        void* object;
+        void (*function)();
+    };
+
+    using InvokeFunc = R (*)(Callee, Args&&...);
+
+    template<typename F>
+    static R invoke_object(Callee callee, Args&&... args) {
+        return Detail::invoke_as<R>(*static_cast<F*>(callee.object), forward<Args>(args)...);
+    }
+
+    template<typename F>
+    static R invoke_function(Callee callee, Args&&... args) {
+        return Detail::invoke_as<R>(*reinterpret_cast<F>(callee.function), forward<Args>(args)...);
+    }
+
+private:
+    Callee m_callee;
+    InvokeFunc m_invoke;
+};
+
+} /* namespace yt */
+
+using yt::Function;
+using yt::FunctionRef;
\ No newline at end of file
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Types.hpp>
+#include <Platform.hpp>
+
+namespace yt {
+
+namespace Detail {
+
+/* "00" "01" ... "99", so decimal conversion emits two digits per division */
+inline constexpr char decimal_digit_pairs[] = "00010203040506070809"
+                                              "10111213141516171819"
+                                              "20212223242526272829"
+                                              "30313233343536373839"
+                                              "40414243444546474849"
+                                              "50515253545556575859"
+                                              "60616263646566676869"
+                                              "70717273747576777879"
+                                              "80818283848586878889"
+                                              "90919293949596979899";
+
+inline constexpr char lowercase_digits[] = "0123456789abcdef";
+inline constexpr char uppercase_digits[] = "0123456789ABCDEF";
+
+template<typename T>
+ALWAYS_INLINE constexpr char* format_decimal(char* end, T value) noexcept {
+    while (value >= 100) {
+        const char* pair = &decimal_digit_pairs[(value % 100) * 2];
+        value /= 100;
+        *--end = pair[1];
+        *--end = pair[0];
+    }
+
+    if (value >= 10) {
+        const char* pair = &decimal_digit_pairs[value * 2];
+        *--end = pair[1];
+        *--end = pair[0];
+    } else {
+        *--end = static_cast<char>('0' + value);
+    }
+
+    return end;
+}
+
+} /* namespace Detail */
+
+/**
+ * Size of a buffer that is large enough for any u64 in any base supported by format_unsigned().
+ */
+inline constexpr usize max_integer_digits = 64;
+
+/**
+ * Writes the digits of `value` right-aligned into the buffer that ends at `end` and returns a pointer to the first digit.
+ * `base` must be 10 or a power of two up to 16. Nothing is null-terminated.
+ */
+constexpr char* format_unsigned(char* end, u64 value, u32 base = 10, bool uppercase = false) noexcept {
+    if (base == 10) {
+        /* 64 bit division is a libgcc call on 32 bit targets, so only use it while needed */
+        if constexpr (sizeof(usize) < sizeof(u64)) {
+            while (value > static_cast<u32>(-1)) {
+                const char* pair = &Detail::decimal_digit_pairs[(value % 100) * 2];
+                value /= 100;
+                *--end = pair[1];
+                *--end = pair[0];
+            }
+            return Detail::format_decimal(end, static_cast<u32>(value));
+        } else {
+            return Detail::format_decimal(end, value);
+        }
+    }
+
+    const char* digits = uppercase ? Detail::uppercase_digits : Detail::lowercase_digits;
+    u32 shift = __builtin_ctz(base);
+    u32 mask = base - 1;
+
+    do {
+        *--end = digits[value & mask];
+        value >>= shift;
+    } while (value);
+
+    return end;
+}
+
+} /* namespace yt */
@@ -0,0 +1,258 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <New.hpp>
+#include <Slice.hpp>
+#include <Types.hpp>
+#include <Atomic.hpp>
+#include <Option.hpp>
+#include <Utility.hpp>
+#include <Platform.hpp>
+#include <Concepts.hpp>
+
+namespace yt {
+
+/**
+ * A bounded lock-free queue for any number of producers and consumers.
+ *
+ * Every slot carries a sequence number that tells which lap of the queue it is ready for:
+ * a slot at position `pos` may be written once its sequence equals `pos` and may be read
+ * once it equals `pos + 1`. Producers and consumers therefore only contend on their own
+ * position counter, which each live on a separate cache line.
+ *
+ * @tparam T Type of the elements
+ * @tparam N Capacity of the queue, must be a power of two
+ */
+template<typename T, usize N>
+requires Destructible<T>
+class MpmcQueue {
+    NOT_COPYABLE(MpmcQueue);
+    NOT_MOVABLE(MpmcQueue);
+
+    static_assert(N >= 2u && (N & (N - 1)) == 0u, "MpmcQueue capacity must be a power of two");
+
+    struct Cell {
+        Atomic<usize> sequence;
+        alignas(T) Byte storage[sizeof(T)];
+
+        ALWAYS_INLINE T* ptr() noexcept {
+            return __builtin_launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+public:
+    using ValueType = T;
+
+    MpmcQueue() noexcept {
+        for (usize i = 0; i < N; i++) {
+            m_cells[i].sequence.store(i, MemoryOrder::Relaxed);
+        }
+    }
+
+    ~MpmcQueue() {
+        while (try_pop().has_value()) {}
+    }
+
+    /**
+     * Returns the maximum number of elements.
+     */
+    NODISCARD ALWAYS_INLINE constexpr usize capacity() const noexcept {
+        return N;
+    }
+
+    /**
+     * Constructs a new element at the back of the queue.
+     * Returns `false` if the queue is full.
+     */
+    template<typename... Args>
+    requires ConstructibleFrom<T, Args...>
+    NODISCARD bool try_emplace(Args&&... args) noexcept(is_nothrow_constructible<T, Args...>) {
+        usize pos = m_enqueue_pos.load(MemoryOrder::Relaxed);
+        Cell* cell;
+
+        while (true) {
+            cell = &m_cells[pos & (N - 1)];
+            isize diff = static_cast<isize>(cell->sequence.load(MemoryOrder::Acquire) - pos);
+
+            if (diff == 0) {
+                if (m_enqueue_pos.compare_exchange(pos, pos + 1, MemoryOrder::Relaxed, MemoryOrder::Relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueue_pos.load(MemoryOrder::Relaxed);
+            }
+        }
+
+        new (cell->ptr()) T(forward<Args>(args)...);
+        cell->sequence.store(pos + 1, MemoryOrder::Release);
+        return true;
+    }
+
+    NODISCARD ALWAYS_INLINE bool try_push(const T& value) noexcept(is_nothrow_copy_constructible<T>) {
+        return try_emplace(value);
+    }
+
+    NODISCARD ALWAYS_INLINE bool try_push(T&& value) noexcept(is_nothrow_move_constructible<T>) {
+        return try_emplace(move(value));
+    }
+
+    /**
+     * Removes the element at the front of the queue.
+     * Returns an empty `Option` if the queue is empty.
+     */
+    NODISCARD Option<T> try_pop() noexcept(is_nothrow_move_constructible<T>) {
+        usize pos = m_dequeue_pos.load(MemoryOrder::Relaxed);
+        Cell* cell;
+
+        while (true) {
+            cell = &m_cells[pos & (N - 1)];
+            isize diff = static_cast<isize>(cell->sequence.load(MemoryOrder::Acquire) - (pos + 1));
+
+            if (diff == 0) {
+                if (m_dequeue_pos.compare_exchange(pos, pos + 1, MemoryOrder::Relaxed, MemoryOrder::Relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return {};
+            } else {
+                pos = m_dequeue_pos.load(MemoryOrder::Relaxed);
+            }
+        }
+
+        Option<T> result(move(*cell->ptr()));
+        cell->ptr()->~T();
+        cell->sequence.store(pos + N, MemoryOrder::Release);
+        return result;
+    }
+
+    /**
+     * Copies as many elements from `values` into the queue as there are consecutive free slots.
+     * The whole run is claimed with a single compare-exchange.
+     * Returns the number of elements pushed.
+     */
+    usize try_push_bulk(Slice<const T> values) noexcept(is_nothrow_copy_constructible<T>) requires CopyConstructible<T> {
+        if (values.is_empty()) {
+            return 0;
+        }
+
+        usize pos = m_enqueue_pos.load(MemoryOrder::Relaxed);
+        usize count;
+
+        while (true) {
+            count = 0;
+            while (count < values.size() && count < N) {
+                Cell& cell = m_cells[(pos + count) & (N - 1)];
+                if (cell.sequence.load(MemoryOrder::Acquire) != pos + count) {
+                    break;
+                }
+                count++;
+            }
+
+            if (count == 0) {
+                isize diff = static_cast<isize>(m_cells[pos & (N - 1)].sequence.load(MemoryOrder::Acquire) - pos);
+                if (diff < 0) {
+                    return 0;
+                }
+
+                pos = m_enqueue_pos.load(MemoryOrder::Relaxed);
+                continue;
+            }
+
+            if (m_enqueue_pos.compare_exchange(pos, pos + count, MemoryOrder::Relaxed, MemoryOrder::Relaxed)) {
+                break;
+            }
+        }
+
+        for (usize i = 0; i < count; i++) {
+            Cell& cell = m_cells[(pos + i) & (N - 1)];
+            new (cell.ptr()) T(values.data()[i]);
+            cell.sequence.store(pos + i + 1, MemoryOrder::Release);
+        }
+
+        return count;
+    }
+
+    /**
+     * Moves as many consecutive ready elements as fit into `out`.
+     * The whole run is claimed with a single compare-exchange.
+     * Returns the number of elements popped.
+     */
+    usize try_pop_bulk(Slice<T> out) noexcept(is_nothrow_move_assignable<T>) requires Movable<T> {
+        if (out.is_empty()) {
+            return 0;
+        }
+
+        usize pos = m_dequeue_pos.load(MemoryOrder::Relaxed);
+        usize count;
+
+        while (true) {
+            count = 0;
+            while (count < out.size() && count < N) {
+                Cell& cell = m_cells[(pos + count) & (N - 1)];
+                if (cell.sequence.load(MemoryOrder::Acquire) != pos + count + 1) {
+                    break;
+                }
+                count++;
+            }
+
+            if (count == 0) {
+                isize diff =
+                    static_cast<isize>(m_cells[pos & (N - 1)].sequence.load(MemoryOrder::Acquire) - (pos + 1));
+                if (diff < 0) {
+                    return 0;
+                }
+
+                pos = m_dequeue_pos.load(MemoryOrder::Relaxed);
+                continue;
+            }
+
+            if (m_dequeue_pos.compare_exchange(pos, pos + count, MemoryOrder::Relaxed, MemoryOrder::Relaxed)) {
+                break;
+            }
+        }
+
+        for (usize i = 0; i < count; i++) {
+            Cell& cell = m_cells[(pos + i) & (N - 1)];
+            out.data()[i] = move(*cell.ptr());
+            cell.ptr()->~T();
+            cell.sequence.store(pos + i + N, MemoryOrder::Release);
+        }
+
+        return count;
+    }
+
+private:
+    alignas(cache_line_size) Atomic<usize> m_enqueue_pos { 0 };
+    alignas(cache_line_size) Atomic<usize> m_dequeue_pos { 0 };
+    alignas(cache_line_size) Cell m_cells[N];
+};
+
+} /* namespace yt */
+
+using yt::MpmcQueue;
\ No newline at end of file
@@ -26,6 +26,7 @@
 #include <stdlib.h>
 
 #include <New.hpp>
+#include <Types.hpp>
 
 void* operator new(size_t size) {
     void* mem = malloc(size);
@@ -59,3 +60,23 @@ void operator delete(void* ptr, size_t size) noexcept {
 void operator delete[](void* ptr, size_t size) noexcept {
     free(ptr);
 }
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    size_t align = static_cast<size_t>(alignment);
+
+    /* the pointer returned by malloc() is kept right in front of the aligned block */
+    void* mem = malloc(size + align - 1 + sizeof(void*));
+    if (!mem) {
+        return nullptr;
+    }
+
+    FlatPtr aligned = (reinterpret_cast<FlatPtr>(mem) + sizeof(void*) + align - 1) & ~(align - 1);
+    reinterpret_cast<void**>(aligned)[-1] = mem;
+    return reinterpret_cast<void*>(aligned);
+}
+
+void operator delete(void* ptr, size_t size, std::align_val_t alignment) noexcept {
+    if (ptr) {
+        free(static_cast<void**>(ptr)[-1]);
+    }
+}
@@ -41,6 +41,14 @@ DISALLOW("operator delete[] with fixed size should be used") void operator delet
 void operator delete(void* ptr, size_t size) noexcept;
 void operator delete[](void* ptr, size_t size) noexcept;
 
+namespace std {
+enum class align_val_t : size_t {};
+}
+
+/* used by new expressions for types aligned beyond what malloc() guarantees */
+void* operator new(size_t size, std::align_val_t alignment);
+void operator delete(void* ptr, size_t size, std::align_val_t alignment) noexcept;
+
 inline void* operator new(size_t, void* ptr) noexcept {
     return ptr;
 }
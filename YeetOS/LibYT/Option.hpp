@@ -27,6 +27,7 @@
 
 #include <New.hpp>
 #include <Types.hpp>
+#include <Traits.hpp>
 #include <Verify.hpp>
 #include <Utility.hpp>
 #include <Platform.hpp>
@@ -35,8 +36,79 @@
 namespace yt {
 
 namespace Detail {
+
 struct InPlaceTag {};
-}
+
+/**
+ * Raw storage for the value of an `Option` next to a flag telling whether it is set.
+ */
+template<typename T>
+class OptionStorage {
+
+public:
+    NODISCARD ALWAYS_INLINE constexpr bool is_set() const noexcept {
+        return m_init;
+    }
+
+    ALWAYS_INLINE constexpr void mark_set() noexcept {
+        m_init = true;
+    }
+
+    ALWAYS_INLINE constexpr void mark_empty() noexcept {
+        m_init = false;
+    }
+
+    ALWAYS_INLINE constexpr T* ptr() noexcept {
+        return __builtin_launder(reinterpret_cast<T*>(addr_of(m_storage)));
+    }
+
+    ALWAYS_INLINE constexpr const T* ptr() const noexcept {
+        return __builtin_launder(reinterpret_cast<const T*>(addr_of(m_storage)));
+    }
+
+private:
+    alignas(T) Byte m_storage[sizeof(T)];
+    bool m_init { false };
+};
+
+/**
+ * Storage for types with a niche: an empty `Option` holds the first spare bit pattern of `T`,
+ * so no separate flag is needed and the `Option` is as large as a `T`.
+ * Note that this makes an `Option` empty once its value is a moved-from `OnwPtr`.
+ */
+template<typename T>
+requires HasNiche<T>
+class OptionStorage<T> {
+    using Niche = NicheTraits<remove_cv<T>>;
+
+public:
+    ALWAYS_INLINE OptionStorage() noexcept {
+        mark_empty();
+    }
+
+    NODISCARD ALWAYS_INLINE bool is_set() const noexcept {
+        return Niche::niche_index(m_storage) >= Niche::niche_count;
+    }
+
+    ALWAYS_INLINE constexpr void mark_set() noexcept {}
+
+    ALWAYS_INLINE void mark_empty() noexcept {
+        Niche::store_niche(m_storage, 0);
+    }
+
+    ALWAYS_INLINE T* ptr() noexcept {
+        return __builtin_launder(reinterpret_cast<T*>(addr_of(m_storage)));
+    }
+
+    ALWAYS_INLINE const T* ptr() const noexcept {
+        return __builtin_launder(reinterpret_cast<const T*>(addr_of(m_storage)));
+    }
+
+private:
+    alignas(T) Byte m_storage[sizeof(T)];
+};
+
+} /* namespace Detail */
 
 template<typename T>
 requires Destructible<T>
@@ -99,7 +171,7 @@ public:
     }
 
     NODISCARD ALWAYS_INLINE constexpr bool has_value() const noexcept {
-        return m_init;
+        return m_storage.is_set();
     }
 
     ALWAYS_INLINE constexpr explicit operator bool() const noexcept {
@@ -133,20 +205,21 @@ public:
     }
 
     NODISCARD ALWAYS_INLINE constexpr T release() noexcept(is_nothrow_move_constructible<T>) {
-        T temp = move(value());
-        value().~T();
-        m_init = false;
+        VERIFY(has_value());
+        T temp = move(*get_ptr());
+        get_ptr()->~T();
+        m_storage.mark_empty();
         return temp;
     }
 
     ALWAYS_INLINE constexpr void clear() noexcept {
         if (has_value()) {
             value().~T();
-            m_init = false;
+            m_storage.mark_empty();
         }
     }
 
-    ~Option() {
+    constexpr ~Option() {
         clear();
     }
 
@@ -164,20 +237,77 @@ private :
     init(Args&&... args) {
         VERIFY(!has_value());
         new (get_ptr()) T(forward<Args>(args)...);
-        m_init = true;
+        m_storage.mark_set();
     }
 
     ALWAYS_INLINE constexpr T* get_ptr() noexcept {
-        return __builtin_launder(reinterpret_cast<T*>(addr_of(m_storage)));
+        return m_storage.ptr();
     }
 
     ALWAYS_INLINE constexpr const T* get_ptr() const noexcept {
-        return __builtin_launder(reinterpret_cast<const T*>(addr_of(m_storage)));
+        return m_storage.ptr();
     }
 
 private:
-    alignas(T) Byte m_storage[sizeof(T)];
-    bool m_init { false };
+    Detail::OptionStorage<T> m_storage;
+};
+
+/**
+ * An optional reference, stored as a pointer that is null while empty.
+ */
+template<typename T>
+class NODISCARD Option<T&> {
+
+public:
+    using ValueType = T&;
+
+    ALWAYS_INLINE constexpr Option() noexcept = default;
+
+    ALWAYS_INLINE constexpr Option(T& value) noexcept : m_ptr(addr_of(value)) {}
+
+    /* an Option<T&> must not refer to a temporary */
+    Option(T&&) = delete;
+
+    ALWAYS_INLINE constexpr Option(const Option&) noexcept = default;
+    ALWAYS_INLINE constexpr Option& operator=(const Option&) noexcept = default;
+
+    ALWAYS_INLINE constexpr void emplace(T& value) noexcept {
+        m_ptr = addr_of(value);
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr bool has_value() const noexcept {
+        return m_ptr != nullptr;
+    }
+
+    ALWAYS_INLINE constexpr explicit operator bool() const noexcept {
+        return has_value();
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr T& value() const noexcept {
+        VERIFY(has_value());
+        return *m_ptr;
+    }
+
+    ALWAYS_INLINE constexpr T& operator*() const noexcept {
+        return value();
+    }
+
+    ALWAYS_INLINE constexpr T* operator->() const noexcept {
+        return &value();
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr T& release() noexcept {
+        T& temp = value();
+        m_ptr = nullptr;
+        return temp;
+    }
+
+    ALWAYS_INLINE constexpr void clear() noexcept {
+        m_ptr = nullptr;
+    }
+
+private:
+    T* m_ptr { nullptr };
 };
 
 template<typename T>
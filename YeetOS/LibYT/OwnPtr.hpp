@@ -26,6 +26,7 @@
 #pragma once
 
 #include <New.hpp>
+#include <Traits.hpp>
 #include <Verify.hpp>
 #include <Utility.hpp>
 #include <Platform.hpp>
@@ -154,6 +155,12 @@ private:
     T* m_ptr { nullptr };
 };
 
+/* an OnwPtr is never null, so the whole first page is spare */
+template<typename T>
+struct NicheTraits<OnwPtr<T>> : Detail::AddressNicheTraits<0> {
+    static_assert(sizeof(OnwPtr<T>) == sizeof(T*));
+};
+
 template<typename T, typename... Args>
 OnwPtr<T> make_owned(Args&&... args) {
     return OnwPtr<T>(new T(forward<Args>(args)...));
@@ -0,0 +1,255 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Array.hpp>
+#include <Types.hpp>
+#include <Option.hpp>
+#include <Verify.hpp>
+#include <Utility.hpp>
+#include <HashCode.hpp>
+#include <Platform.hpp>
+
+namespace yt {
+
+/**
+ * A read-only map over a fixed set of keys, built at compile time with a perfect hash.
+ *
+ * The keys are hashed with `hash_code()` and distributed over buckets. Following the CHD
+ * (hash, displace and compress) scheme, each bucket stores a displacement that moves all of
+ * its keys to free slots of the table without collisions. A lookup is thus one key hash,
+ * a few integer operations and a single key comparison, without any probing.
+ *
+ * Use `make_perfect_hash_map()` in a `constexpr` context so the table ends up in the image
+ * and costs nothing at runtime. If no perfect hash can be found, or a key is duplicated,
+ * construction fails and so does the compilation.
+ *
+ * @tparam K the key type, must be hashable and equality comparable in constant expressions.
+ * @tparam V the value type.
+ * @tparam N the number of entries.
+ */
+template<typename K, typename V, usize N>
+requires Hashable<K> && EqualityCompareable<K>
+class PerfectHashMap {
+    static_assert(N > 0, "a PerfectHashMap must not be empty");
+
+public:
+    struct Entry {
+        K key;
+        V value;
+    };
+
+    /* around two keys per bucket keeps the displacement search short */
+    static constexpr usize bucket_count = N / 2 + 1;
+
+    /* at least 1.25 slots per key, a completely full table makes the last buckets hard to place */
+    static constexpr usize table_size = [] {
+        usize size = 1;
+        while (size < N + (N + 3) / 4) {
+            size *= 2;
+        }
+        return size;
+    }();
+
+    constexpr explicit PerfectHashMap(const Entry (&entries)[N]) {
+        for (usize i = 0; i < N; i++) {
+            m_entries[i] = entries[i];
+        }
+
+        build();
+    }
+
+    /**
+     * Returns the value stored for `key`.
+     */
+    NODISCARD constexpr Option<const V&> get(const K& key) const noexcept {
+        const Entry& entry = m_entries[m_slots[slot_of(key)]];
+
+        if (entry.key == key) {
+            return entry.value;
+        }
+
+        return {};
+    }
+
+    NODISCARD constexpr bool contains(const K& key) const noexcept {
+        return get(key).has_value();
+    }
+
+    NODISCARD constexpr usize size() const noexcept {
+        return N;
+    }
+
+    NODISCARD constexpr const Entry* begin() const noexcept {
+        return m_entries.data();
+    }
+
+    NODISCARD constexpr const Entry* end() const noexcept {
+        return m_entries.data() + N;
+    }
+
+private:
+    struct KeyHash {
+        usize bucket;
+        HashCode base;
+        HashCode step;
+    };
+
+    static constexpr KeyHash hash_key(const K& key) noexcept {
+        HashCode hash = hash_code(key);
+        HashCode second = hash_code(hash);
+
+        return {
+            .bucket = static_cast<usize>(second % bucket_count),
+            .base = hash,
+            .step = hash_code(second) | 1,
+        };
+    }
+
+    /**
+     * A displacement encodes a multiplier of the step in its high part and an offset in its low part.
+     */
+    static constexpr usize displaced_slot(const KeyHash& hash, u32 displacement) noexcept {
+        HashCode multiplier = displacement / table_size;
+        HashCode offset = displacement % table_size;
+        return static_cast<usize>((hash.base + multiplier * hash.step + offset) & (table_size - 1));
+    }
+
+    constexpr usize slot_of(const K& key) const noexcept {
+        KeyHash hash = hash_key(key);
+        return displaced_slot(hash, m_displacements[hash.bucket]);
+    }
+
+    constexpr void build() {
+        Array<KeyHash, N> hashes {};
+        Array<usize, bucket_count + 1> bucket_starts {};
+        Array<usize, N> bucket_keys {};
+        Array<usize, bucket_count> bucket_order {};
+        Array<bool, table_size> occupied {};
+
+        for (usize i = 0; i < N; i++) {
+            for (usize j = 0; j < i; j++) {
+                VERIFY(!(m_entries[i].key == m_entries[j].key));
+            }
+
+            hashes[i] = hash_key(m_entries[i].key);
+            bucket_starts[hashes[i].bucket + 1]++;
+        }
+
+        /* group the keys by bucket, the keys of bucket b are bucket_keys[bucket_starts[b]..bucket_starts[b + 1]) */
+        for (usize i = 0; i < bucket_count; i++) {
+            bucket_starts[i + 1] += bucket_starts[i];
+        }
+
+        {
+            Array<usize, bucket_count> filled {};
+            for (usize i = 0; i < N; i++) {
+                usize bucket = hashes[i].bucket;
+                bucket_keys[bucket_starts[bucket] + filled[bucket]++] = i;
+            }
+        }
+
+        auto bucket_size = [&](usize bucket) {
+            return bucket_starts[bucket + 1] - bucket_starts[bucket];
+        };
+
+        /* place the largest buckets first while the table is still mostly empty */
+        for (usize i = 0; i < bucket_count; i++) {
+            usize j = i;
+            for (; j > 0 && bucket_size(bucket_order[j - 1]) < bucket_size(i); j--) {
+                bucket_order[j] = bucket_order[j - 1];
+            }
+            bucket_order[j] = i;
+        }
+
+        for (usize i = 0; i < table_size; i++) {
+            m_slots[i] = 0;
+        }
+
+        for (usize bucket : bucket_order) {
+            if (bucket_size(bucket) == 0) {
+                break;
+            }
+
+            const usize* keys = bucket_keys.data() + bucket_starts[bucket];
+            m_displacements[bucket] = find_displacement(keys, bucket_size(bucket), hashes, occupied);
+        }
+    }
+
+    /**
+     * Finds a displacement that moves the `count` keys at `keys` (indices into the entries) to free slots.
+     */
+    constexpr u32 find_displacement(const usize* keys, usize count, const Array<KeyHash, N>& hashes,
+                                    Array<bool, table_size>& occupied) {
+        constexpr usize max_displacement = table_size * table_size;
+
+        for (usize displacement = 0; displacement < max_displacement; displacement++) {
+            usize placed = 0;
+
+            for (; placed < count; placed++) {
+                usize key = keys[placed];
+                usize slot = displaced_slot(hashes[key], static_cast<u32>(displacement));
+
+                if (occupied[slot]) {
+                    break;
+                }
+
+                occupied[slot] = true;
+                m_slots[slot] = static_cast<u32>(key);
+            }
+
+            if (placed == count) {
+                return static_cast<u32>(displacement);
+            }
+
+            /* undo the partial placement and try the next displacement */
+            for (usize i = 0; i < placed; i++) {
+                occupied[displaced_slot(hashes[keys[i]], static_cast<u32>(displacement))] = false;
+            }
+        }
+
+        VERIFY_NOT_REACHED();
+    }
+
+private:
+    Array<Entry, N> m_entries {};
+    Array<u32, table_size> m_slots {};
+    Array<u32, bucket_count> m_displacements {};
+};
+
+/**
+ * Builds a `PerfectHashMap` from a list of entries:
+ * `constexpr auto map = make_perfect_hash_map<StringView, int>({ { "read"_sv, 0 }, { "write"_sv, 1 } });`
+ */
+template<typename K, typename V, usize N>
+constexpr PerfectHashMap<K, V, N> make_perfect_hash_map(const typename PerfectHashMap<K, V, N>::Entry (&entries)[N]) {
+    return PerfectHashMap<K, V, N>(entries);
+}
+
+} /* namespace yt */
+
+using yt::make_perfect_hash_map;
+using yt::PerfectHashMap;
\ No newline at end of file
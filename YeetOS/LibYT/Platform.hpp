@@ -45,6 +45,9 @@ inline constexpr bool is_big_endian = __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__;
 
 inline constexpr decltype(sizeof(char)) char_bits = __CHAR_BIT__;
 
+/* Size of a cache line, used to keep data written by different CPUs apart. */
+inline constexpr decltype(sizeof(char)) cache_line_size = 64;
+
 #endif /* __cplusplus */
 
 #undef ALWAYS_INLINE
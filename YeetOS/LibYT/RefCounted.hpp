@@ -0,0 +1,212 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Types.hpp>
+#include <Atomic.hpp>
+#include <Verify.hpp>
+#include <Platform.hpp>
+
+namespace yt {
+
+template<typename T>
+class WeakPtr;
+
+namespace Detail {
+
+/**
+ * The control block shared between an object and its `WeakPtr`s.
+ *
+ * It is only allocated once the first `WeakPtr` to an object is created and outlives the object
+ * as long as any `WeakPtr` still refers to it.
+ */
+class WeakLink {
+    NOT_COPYABLE(WeakLink);
+    NOT_MOVABLE(WeakLink);
+
+public:
+    explicit WeakLink(void* ptr) noexcept : m_ptr(ptr) {}
+
+    ALWAYS_INLINE void ref() noexcept {
+        m_ref_count.fetch_add(1, MemoryOrder::Relaxed);
+    }
+
+    ALWAYS_INLINE void unref() noexcept {
+        if (m_ref_count.fetch_sub(1, MemoryOrder::AcqRel) == 1) {
+            delete this;
+        }
+    }
+
+    /**
+     * Returns the object with an additional strong reference or `nullptr` if it is already being destroyed.
+     */
+    template<typename T>
+    T* try_ref_object() noexcept {
+        lock();
+
+        T* ptr = static_cast<T*>(m_ptr.load(MemoryOrder::Relaxed));
+        if (ptr && !ptr->try_ref()) {
+            ptr = nullptr;
+        }
+
+        unlock();
+        return ptr;
+    }
+
+    NODISCARD ALWAYS_INLINE bool is_revoked() const noexcept {
+        return m_ptr.load(MemoryOrder::Acquire) == nullptr;
+    }
+
+    /**
+     * Called by the object right before it is destroyed.
+     *
+     * Taking the lock guarantees that no `try_ref_object()` still touches the object afterwards.
+     */
+    void revoke() noexcept {
+        lock();
+        m_ptr.store(nullptr, MemoryOrder::Release);
+        unlock();
+    }
+
+private:
+    ALWAYS_INLINE void lock() noexcept {
+        while (m_lock.exchange(true, MemoryOrder::Acquire)) {
+            while (m_lock.load(MemoryOrder::Relaxed)) {}
+        }
+    }
+
+    ALWAYS_INLINE void unlock() noexcept {
+        m_lock.store(false, MemoryOrder::Release);
+    }
+
+private:
+    Atomic<u32> m_ref_count { 1 };
+    Atomic<bool> m_lock { false };
+    Atomic<void*> m_ptr;
+};
+
+} /* namespace Detail */
+
+/**
+ * Base class of intrusively reference counted objects.
+ *
+ * The count lives inside the object, so creating a `RefPtr` needs no extra allocation.
+ * Increments are relaxed since taking a new reference requires already holding one;
+ * decrements are release and the final one acquires, so every write to the object
+ * happens before its destruction.
+ *
+ * @tparam T the derived type, deleted once the last reference is dropped.
+ */
+template<typename T>
+class RefCounted {
+    NOT_COPYABLE(RefCounted);
+    NOT_MOVABLE(RefCounted);
+
+    template<typename U>
+    friend class WeakPtr;
+
+public:
+    using RefCountType = u32;
+
+    ALWAYS_INLINE void ref() const noexcept {
+        RefCountType old = m_ref_count.fetch_add(1, MemoryOrder::Relaxed);
+        VERIFY(old > 0);
+    }
+
+    /**
+     * Takes a reference unless the count already dropped to zero.
+     */
+    NODISCARD ALWAYS_INLINE bool try_ref() const noexcept {
+        RefCountType count = m_ref_count.load(MemoryOrder::Relaxed);
+
+        while (count != 0) {
+            if (m_ref_count.compare_exchange(count, count + 1, MemoryOrder::Acquire, MemoryOrder::Relaxed)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    ALWAYS_INLINE void unref() const noexcept {
+        RefCountType old = m_ref_count.fetch_sub(1, MemoryOrder::Release);
+        VERIFY(old > 0);
+
+        if (old == 1) {
+            atomic_thread_fence(MemoryOrder::Acquire);
+            destroy();
+        }
+    }
+
+    NODISCARD ALWAYS_INLINE RefCountType ref_count() const noexcept {
+        return m_ref_count.load(MemoryOrder::Relaxed);
+    }
+
+protected:
+    RefCounted() noexcept = default;
+
+    ~RefCounted() {
+        VERIFY(m_ref_count.load(MemoryOrder::Relaxed) == 0);
+    }
+
+private:
+    NEVER_INLINE void destroy() const noexcept {
+        if (Detail::WeakLink* link = m_weak_link.load(MemoryOrder::Acquire)) {
+            link->revoke();
+            link->unref();
+        }
+
+        delete static_cast<const T*>(this);
+    }
+
+    /**
+     * Returns the weak link of this object and creates it if needed.
+     */
+    Detail::WeakLink* ensure_weak_link() const {
+        Detail::WeakLink* link = m_weak_link.load(MemoryOrder::Acquire);
+        if (link) {
+            return link;
+        }
+
+        auto* new_link = new Detail::WeakLink(const_cast<T*>(static_cast<const T*>(this)));
+
+        if (m_weak_link.compare_exchange(link, new_link, MemoryOrder::AcqRel, MemoryOrder::Acquire)) {
+            return new_link;
+        }
+
+        /* somebody else was faster, use their link */
+        delete new_link;
+        return link;
+    }
+
+private:
+    mutable Atomic<RefCountType> m_ref_count { 1 };
+    mutable Atomic<Detail::WeakLink*> m_weak_link { nullptr };
+};
+
+} /* namespace yt */
+
+using yt::RefCounted;
\ No newline at end of file
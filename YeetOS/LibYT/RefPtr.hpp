@@ -0,0 +1,186 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <New.hpp>
+#include <Traits.hpp>
+#include <Verify.hpp>
+#include <Utility.hpp>
+#include <Platform.hpp>
+#include <RefCounted.hpp>
+
+namespace yt {
+
+/**
+ * A shared pointer to an intrusively reference counted object that is not null.
+ *
+ * Copying a `RefPtr` takes a new reference, destroying it drops one.
+ * Moving leaves the source empty, after which it may only be destroyed or assigned to.
+ *
+ * @tparam T the underlying type, usually derived from `RefCounted<T>`.
+ */
+template<typename T>
+class RefPtr {
+    template<typename U>
+    friend class RefPtr;
+
+public:
+    using ValueType = T;
+
+    enum AdoptTag { Adopt };
+
+    /* not default constructible */
+    RefPtr() = delete;
+
+    /* delete operator bool and operator! since RefPtr is never null. */
+    operator bool() const = delete;
+    bool operator!() const = delete;
+
+    ALWAYS_INLINE RefPtr(T& object) : m_ptr(&object) {
+        m_ptr->ref();
+    }
+
+    /**
+     * Takes over an existing reference without incrementing the count.
+     */
+    ALWAYS_INLINE RefPtr(AdoptTag, T& object) : m_ptr(&object) {}
+
+    ALWAYS_INLINE RefPtr(const RefPtr& other) : m_ptr(other.m_ptr) {
+        VERIFY(m_ptr);
+        m_ptr->ref();
+    }
+
+    template<typename U>
+    ALWAYS_INLINE RefPtr(const RefPtr<U>& other) : m_ptr(other.m_ptr) {
+        VERIFY(m_ptr);
+        m_ptr->ref();
+    }
+
+    ALWAYS_INLINE RefPtr(RefPtr&& other) : m_ptr(other.leak_ref()) {}
+
+    template<typename U>
+    ALWAYS_INLINE RefPtr(RefPtr<U>&& other) : m_ptr(other.leak_ref()) {}
+
+    ALWAYS_INLINE RefPtr& operator=(const RefPtr& other) {
+        RefPtr ptr(other);
+        swap(ptr);
+        return *this;
+    }
+
+    template<typename U>
+    ALWAYS_INLINE RefPtr& operator=(const RefPtr<U>& other) {
+        RefPtr ptr(other);
+        swap(ptr);
+        return *this;
+    }
+
+    ALWAYS_INLINE RefPtr& operator=(RefPtr&& other) {
+        RefPtr ptr(move(other));
+        swap(ptr);
+        return *this;
+    }
+
+    template<typename U>
+    ALWAYS_INLINE RefPtr& operator=(RefPtr<U>&& other) {
+        RefPtr ptr(move(other));
+        swap(ptr);
+        return *this;
+    }
+
+    ~RefPtr() {
+        clear();
+    }
+
+    RETURNS_NONNULL ALWAYS_INLINE T* ptr() const noexcept {
+        VERIFY(m_ptr);
+        return m_ptr;
+    }
+
+    /**
+     * Returns the stored pointer without dropping its reference and invalidates the `RefPtr`.
+     */
+    NODISCARD ALWAYS_INLINE T* leak_ref() noexcept {
+        VERIFY(m_ptr);
+        return exchange(m_ptr, nullptr);
+    }
+
+    ALWAYS_INLINE void swap(RefPtr& other) noexcept {
+        ::swap(m_ptr, other.m_ptr);
+    }
+
+    ALWAYS_INLINE T* operator->() const noexcept {
+        return ptr();
+    }
+
+    ALWAYS_INLINE T& operator*() const noexcept {
+        return *ptr();
+    }
+
+    ALWAYS_INLINE operator T*() const noexcept {
+        return ptr();
+    }
+
+    template<typename U>
+    ALWAYS_INLINE bool operator==(const RefPtr<U>& other) const noexcept {
+        return m_ptr == other.m_ptr;
+    }
+
+private:
+    ALWAYS_INLINE void clear() noexcept {
+        if (m_ptr) {
+            m_ptr->unref();
+            m_ptr = nullptr;
+        }
+    }
+
+private:
+    T* m_ptr { nullptr };
+};
+
+/* a RefPtr is never null, so the whole first page is spare */
+template<typename T>
+struct NicheTraits<RefPtr<T>> : Detail::AddressNicheTraits<0> {
+    static_assert(sizeof(RefPtr<T>) == sizeof(T*));
+};
+
+/**
+ * Wraps a freshly created object, whose count starts at one, into a `RefPtr`.
+ */
+template<typename T>
+ALWAYS_INLINE RefPtr<T> adopt_ref(T& object) {
+    return RefPtr<T>(RefPtr<T>::Adopt, object);
+}
+
+template<typename T, typename... Args>
+RefPtr<T> make_ref_counted(Args&&... args) {
+    return adopt_ref(*new T(forward<Args>(args)...));
+}
+
+} /* namespace yt */
+
+using yt::adopt_ref;
+using yt::make_ref_counted;
+using yt::RefPtr;
\ No newline at end of file
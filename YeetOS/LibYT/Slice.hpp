@@ -26,8 +26,13 @@
 #pragma once
 
 #include <Types.hpp>
+#include <Option.hpp>
 #include <Verify.hpp>
+#include <Utility.hpp>
 #include <Platform.hpp>
+#include <TypeMagic.hpp>
+
+#include <string.h>
 
 namespace yt {
 
@@ -258,10 +263,145 @@ public:
      *
      * UB if `start + size > this->size()`
      */
-    NODISCARD ALWAYS_INLINE constexpr Slice subslice(usize start, usize size) const noexcept {
+    NODISCARD ALWAYS_INLINE constexpr Slice subslice(usize start, usize size) noexcept {
         VERIFY(start + size <= this->size());
         return Slice { data() + start, size };
     }
+
+    /**
+     * Retruns a slice beginning at the specified start index and with the specified size.
+     *
+     * UB if `start + size > this->size()`
+     */
+    NODISCARD ALWAYS_INLINE constexpr Slice<const T> subslice(usize start, usize size) const noexcept {
+        VERIFY(start + size <= this->size());
+        return Slice<const T> { data() + start, size };
+    }
+
+    /**
+     * Retruns a slice of all elements from the specified start index onwards.
+     *
+     * UB if `start > this->size()`
+     */
+    NODISCARD ALWAYS_INLINE constexpr Slice subslice(usize start) noexcept {
+        VERIFY(start <= size());
+        return subslice(start, size() - start);
+    }
+
+    /**
+     * Retruns a slice of all elements from the specified start index onwards.
+     *
+     * UB if `start > this->size()`
+     */
+    NODISCARD ALWAYS_INLINE constexpr Slice<const T> subslice(usize start) const noexcept {
+        VERIFY(start <= size());
+        return subslice(start, size() - start);
+    }
+
+    /**
+     * Copies the elements of `source` to the beginning of this slice. The slices must not overlap.
+     * Uses `memcpy()` for trivially copyable types.
+     *
+     * UB if `source.size() > size()`
+     */
+    template<typename U>
+    requires SameAs<remove_cv<U>, remove_cv<T>>
+    constexpr void copy_from(Slice<U> source) noexcept(is_nothrow_copy_assignable<remove_cv<T>>) {
+        VERIFY(source.size() <= size());
+
+        if constexpr (is_trivially_copyable<T>) {
+            if (!is_constant_evaluated()) {
+                if (!source.is_empty()) {
+                    memcpy(data(), source.data(), source.size() * sizeof(T));
+                }
+                return;
+            }
+        }
+
+        for (usize i = 0; i < source.size(); i++) {
+            data()[i] = source.data()[i];
+        }
+    }
+
+    /**
+     * Assigns `value` to all elements. Uses `memset()` for trivially copyable single byte types.
+     */
+    constexpr void fill(const T& value) noexcept(is_nothrow_copy_assignable<remove_cv<T>>) {
+        if constexpr (is_trivially_copyable<T> && sizeof(T) == 1) {
+            if (!is_constant_evaluated()) {
+                memset(data(), static_cast<int>(bit_cast<u8>(value)), size());
+                return;
+            }
+        }
+
+        for (usize i = 0; i < size(); i++) {
+            data()[i] = value;
+        }
+    }
+
+    /**
+     * Checks whether both slices have the same size and equal elements.
+     * Uses `memcmp()` for types that are equal exactly when their bytes are.
+     */
+    template<typename U>
+    requires SameAs<remove_cv<U>, remove_cv<T>>
+    NODISCARD constexpr bool equals(Slice<U> other) const noexcept {
+        if (size() != other.size()) {
+            return false;
+        }
+
+        if constexpr (is_trivially_comparable<T>) {
+            if (!is_constant_evaluated()) {
+                return is_empty() || memcmp(data(), other.data(), size() * sizeof(T)) == 0;
+            }
+        }
+
+        for (usize i = 0; i < size(); i++) {
+            if (!(data()[i] == other.data()[i])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Checks whether the slice begins with the elements of `prefix`.
+     */
+    template<typename U>
+    requires SameAs<remove_cv<U>, remove_cv<T>>
+    NODISCARD constexpr bool starts_with(Slice<U> prefix) const noexcept {
+        return prefix.size() <= size() && subslice(0, prefix.size()).equals(prefix);
+    }
+
+    /**
+     * Returns the index of the first element equal to `value`.
+     * Uses `memchr()` for single byte types that are equal exactly when their bytes are.
+     */
+    NODISCARD constexpr Option<usize> find(const T& value) const noexcept {
+        if constexpr (is_trivially_comparable<T> && sizeof(T) == 1) {
+            if (!is_constant_evaluated()) {
+                if (is_empty()) {
+                    return {};
+                }
+
+                const void* found = memchr(data(), static_cast<int>(bit_cast<u8>(value)), size());
+                if (!found) {
+                    return {};
+                }
+
+                return static_cast<usize>(static_cast<const T*>(found) - data());
+            }
+        }
+
+        for (usize i = 0; i < size(); i++) {
+            if (data()[i] == value) {
+                return i;
+            }
+        }
+
+        return {};
+    }
 };
 
 template<typename T>
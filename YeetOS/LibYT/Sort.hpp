@@ -0,0 +1,787 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Slice.hpp>
+#include <Types.hpp>
+#include <Ranges.hpp>
+#include <Traits.hpp>
+#include <Utility.hpp>
+#include <Concepts.hpp>
+#include <Platform.hpp>
+#include <TypeMagic.hpp>
+
+namespace yt {
+
+namespace Detail::Sort {
+
+/* Ranges shorter than this are sorted with insertion sort. */
+inline constexpr isize insertion_sort_threshold = 24;
+
+/* Ranges longer than this use the pseudomedian of nine as pivot. */
+inline constexpr isize ninther_threshold = 128;
+
+/* Number of element moves after which partial_insertion_sort() gives up. */
+inline constexpr isize partial_insertion_sort_limit = 8;
+
+/* Number of elements classified per block by the branchless partition. */
+inline constexpr usize block_size = 64;
+
+/* Block size of the stable sort's initial insertion sort pass. */
+inline constexpr isize stable_block_size = 20;
+
+template<typename Iter>
+ALWAYS_INLINE constexpr void iter_swap(Iter a, Iter b) {
+    swap(*a, *b);
+}
+
+template<typename Iter, typename Compare>
+constexpr void insertion_sort(Iter begin, Iter end, Compare& comp) {
+    using T = ValueTypeOf<Iter>;
+
+    if (begin == end) {
+        return;
+    }
+
+    for (Iter cur = begin + 1; cur != end; ++cur) {
+        Iter sift = cur;
+        Iter sift_1 = cur - 1;
+
+        /* compare first so an element that is already in place costs no moves */
+        if (comp(*sift, *sift_1)) {
+            T temp = move(*sift);
+
+            do {
+                *sift-- = move(*sift_1);
+            } while (sift != begin && comp(temp, *--sift_1));
+
+            *sift = move(temp);
+        }
+    }
+}
+
+/**
+ * Insertion sort that relies on `*(begin - 1)` being less or equal to every element of the range,
+ * which removes the bounds check from the inner loop.
+ */
+template<typename Iter, typename Compare>
+constexpr void unguarded_insertion_sort(Iter begin, Iter end, Compare& comp) {
+    using T = ValueTypeOf<Iter>;
+
+    if (begin == end) {
+        return;
+    }
+
+    for (Iter cur = begin + 1; cur != end; ++cur) {
+        Iter sift = cur;
+        Iter sift_1 = cur - 1;
+
+        if (comp(*sift, *sift_1)) {
+            T temp = move(*sift);
+
+            do {
+                *sift-- = move(*sift_1);
+            } while (comp(temp, *--sift_1));
+
+            *sift = move(temp);
+        }
+    }
+}
+
+/**
+ * Attempts an insertion sort and gives up once more than `partial_insertion_sort_limit` moves were needed.
+ * Returns `true` if the range is sorted afterwards.
+ */
+template<typename Iter, typename Compare>
+constexpr bool partial_insertion_sort(Iter begin, Iter end, Compare& comp) {
+    using T = ValueTypeOf<Iter>;
+
+    if (begin == end) {
+        return true;
+    }
+
+    isize limit = 0;
+
+    for (Iter cur = begin + 1; cur != end; ++cur) {
+        Iter sift = cur;
+        Iter sift_1 = cur - 1;
+
+        if (comp(*sift, *sift_1)) {
+            T temp = move(*sift);
+
+            do {
+                *sift-- = move(*sift_1);
+            } while (sift != begin && comp(temp, *--sift_1));
+
+            *sift = move(temp);
+            limit += cur - sift;
+        }
+
+        if (limit > partial_insertion_sort_limit) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename Iter, typename Compare>
+ALWAYS_INLINE constexpr void sort2(Iter a, Iter b, Compare& comp) {
+    if (comp(*b, *a)) {
+        iter_swap(a, b);
+    }
+}
+
+template<typename Iter, typename Compare>
+ALWAYS_INLINE constexpr void sort3(Iter a, Iter b, Iter c, Compare& comp) {
+    sort2(a, b, comp);
+    sort2(b, c, comp);
+    sort2(a, b, comp);
+}
+
+template<typename Iter, typename Compare>
+constexpr void sift_down(Iter begin, isize size, isize index, Compare& comp) {
+    using T = ValueTypeOf<Iter>;
+
+    T value = move(begin[index]);
+
+    while (true) {
+        isize child = 2 * index + 1;
+        if (child >= size) {
+            break;
+        }
+
+        if (child + 1 < size && comp(begin[child], begin[child + 1])) {
+            child++;
+        }
+
+        if (!comp(value, begin[child])) {
+            break;
+        }
+
+        begin[index] = move(begin[child]);
+        index = child;
+    }
+
+    begin[index] = move(value);
+}
+
+/**
+ * Fallback with guaranteed O(n log n) if the quicksort keeps choosing bad pivots.
+ */
+template<typename Iter, typename Compare>
+constexpr void heap_sort(Iter begin, Iter end, Compare& comp) {
+    isize size = end - begin;
+
+    for (isize i = size / 2; i > 0; i--) {
+        sift_down(begin, size, i - 1, comp);
+    }
+
+    for (isize i = size - 1; i > 0; i--) {
+        iter_swap(begin, begin + i);
+        sift_down(begin, i, 0, comp);
+    }
+}
+
+template<typename Iter>
+struct PartitionResult {
+    Iter pivot;
+    bool already_partitioned;
+};
+
+template<typename Iter>
+ALWAYS_INLINE constexpr void swap_offsets(Iter first,
+                                          Iter last,
+                                          u8* offsets_l,
+                                          u8* offsets_r,
+                                          usize count,
+                                          bool use_swaps) {
+    using T = ValueTypeOf<Iter>;
+
+    if (use_swaps) {
+        /* needed for descending inputs, where a cyclic permutation would keep the partition unbalanced */
+        for (usize i = 0; i < count; i++) {
+            iter_swap(first + offsets_l[i], last - offsets_r[i]);
+        }
+    } else if (count > 0) {
+        Iter l = first + offsets_l[0];
+        Iter r = last - offsets_r[0];
+        T temp = move(*l);
+        *l = move(*r);
+
+        for (usize i = 1; i < count; i++) {
+            l = first + offsets_l[i];
+            *r = move(*l);
+            r = last - offsets_r[i];
+            *l = move(*r);
+        }
+
+        *r = move(temp);
+    }
+}
+
+/**
+ * Partitions [begin, end) around `*begin` using the block partitioning scheme from
+ * "BlockQuicksort: How Branch Mispredictions don't affect Quicksort" (Edelkamp, Weiss).
+ *
+ * Elements are first classified into offset buffers without any data dependent branches,
+ * then swapped in bulk. Only worth it if `comp` itself is branch free.
+ */
+template<typename Iter, typename Compare>
+constexpr PartitionResult<Iter> partition_right_branchless(Iter begin, Iter end, Compare& comp) {
+    using T = ValueTypeOf<Iter>;
+
+    T pivot = move(*begin);
+    Iter first = begin;
+    Iter last = end;
+
+    /* the median of three guarantees that an element >= pivot exists */
+    while (comp(*++first, pivot)) {}
+
+    /* only guard the search if there was no element before first */
+    if (first - 1 == begin) {
+        while (first < last && !comp(*--last, pivot)) {}
+    } else {
+        while (!comp(*--last, pivot)) {}
+    }
+
+    bool already_partitioned = first >= last;
+
+    if (!already_partitioned) {
+        iter_swap(first, last);
+        ++first;
+
+        alignas(cache_line_size) u8 offsets_l[block_size];
+        alignas(cache_line_size) u8 offsets_r[block_size];
+
+        Iter offsets_l_base = first;
+        Iter offsets_r_base = last;
+        usize num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+        while (first < last) {
+            /* decide how many elements go into each offset block */
+            usize num_unknown = last - first;
+            usize left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+            usize right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+            /* fill the offset blocks with the positions of elements on the wrong side */
+            usize count_l = min(left_split, block_size);
+            for (usize i = 0; i < count_l; i++) {
+                offsets_l[num_l] = static_cast<u8>(i);
+                num_l += !comp(*first, pivot);
+                ++first;
+            }
+
+            usize count_r = min(right_split, block_size);
+            for (usize i = 0; i < count_r; i++) {
+                offsets_r[num_r] = static_cast<u8>(i + 1);
+                num_r += comp(*--last, pivot);
+            }
+
+            usize count = min(num_l, num_r);
+            swap_offsets(offsets_l_base,
+                         offsets_r_base,
+                         offsets_l + start_l,
+                         offsets_r + start_r,
+                         count,
+                         num_l == num_r);
+
+            num_l -= count;
+            num_r -= count;
+            start_l += count;
+            start_r += count;
+
+            if (num_l == 0) {
+                start_l = 0;
+                offsets_l_base = first;
+            }
+
+            if (num_r == 0) {
+                start_r = 0;
+                offsets_r_base = last;
+            }
+        }
+
+        /* one side still has misplaced elements, move them next to the boundary */
+        if (num_l) {
+            u8* offsets = offsets_l + start_l;
+            while (num_l--) {
+                iter_swap(offsets_l_base + offsets[num_l], --last);
+            }
+            first = last;
+        }
+
+        if (num_r) {
+            u8* offsets = offsets_r + start_r;
+            while (num_r--) {
+                iter_swap(offsets_r_base - offsets[num_r], first);
+                ++first;
+            }
+            last = first;
+        }
+    }
+
+    Iter pivot_pos = first - 1;
+    *begin = move(*pivot_pos);
+    *pivot_pos = move(pivot);
+
+    return { pivot_pos, already_partitioned };
+}
+
+/**
+ * Partitions [begin, end) around `*begin`. Elements equal to the pivot end up on the right.
+ */
+template<typename Iter, typename Compare>
+constexpr PartitionResult<Iter> partition_right(Iter begin, Iter end, Compare& comp) {
+    using T = ValueTypeOf<Iter>;
+
+    T pivot = move(*begin);
+    Iter first = begin;
+    Iter last = end;
+
+    while (comp(*++first, pivot)) {}
+
+    if (first - 1 == begin) {
+        while (first < last && !comp(*--last, pivot)) {}
+    } else {
+        while (!comp(*--last, pivot)) {}
+    }
+
+    bool already_partitioned = first >= last;
+
+    while (first < last) {
+        iter_swap(first, last);
+        while (comp(*++first, pivot)) {}
+        while (!comp(*--last, pivot)) {}
+    }
+
+    Iter pivot_pos = first - 1;
+    *begin = move(*pivot_pos);
+    *pivot_pos = move(pivot);
+
+    return { pivot_pos, already_partitioned };
+}
+
+/**
+ * Partitions [begin, end) around `*begin`. Elements equal to the pivot end up on the left.
+ * Used when the pivot equals the element before the range, so all elements equal to it are done.
+ */
+template<typename Iter, typename Compare>
+constexpr Iter partition_left(Iter begin, Iter end, Compare& comp) {
+    using T = ValueTypeOf<Iter>;
+
+    T pivot = move(*begin);
+    Iter first = begin;
+    Iter last = end;
+
+    while (comp(pivot, *--last)) {}
+
+    if (last + 1 == end) {
+        while (first < last && !comp(pivot, *++first)) {}
+    } else {
+        while (!comp(pivot, *++first)) {}
+    }
+
+    while (first < last) {
+        iter_swap(first, last);
+        while (comp(pivot, *--last)) {}
+        while (!comp(pivot, *++first)) {}
+    }
+
+    Iter pivot_pos = last;
+    *begin = move(*pivot_pos);
+    *pivot_pos = move(pivot);
+
+    return pivot_pos;
+}
+
+template<bool Branchless, typename Iter, typename Compare>
+ALWAYS_INLINE constexpr PartitionResult<Iter> partition(Iter begin, Iter end, Compare& comp) {
+    if constexpr (Branchless) {
+        return partition_right_branchless(begin, end, comp);
+    } else {
+        return partition_right(begin, end, comp);
+    }
+}
+
+template<bool Branchless, typename Iter, typename Compare>
+constexpr void pdqsort_loop(Iter begin, Iter end, Compare& comp, int bad_allowed, bool leftmost) {
+    while (true) {
+        isize size = end - begin;
+
+        if (size < insertion_sort_threshold) {
+            if (leftmost) {
+                insertion_sort(begin, end, comp);
+            } else {
+                unguarded_insertion_sort(begin, end, comp);
+            }
+            return;
+        }
+
+        /* choose the pivot as median of three or pseudomedian of nine */
+        isize s2 = size / 2;
+        if (size > ninther_threshold) {
+            sort3(begin, begin + s2, end - 1, comp);
+            sort3(begin + 1, begin + (s2 - 1), end - 2, comp);
+            sort3(begin + 2, begin + (s2 + 1), end - 3, comp);
+            sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp);
+            iter_swap(begin, begin + s2);
+        } else {
+            sort3(begin + s2, begin, end - 1, comp);
+        }
+
+        /*
+         * If the pivot equals the element before this range, every element equal to the pivot
+         * is already in its final place and only the greater ones need to be sorted.
+         */
+        if (!leftmost && !comp(*(begin - 1), *begin)) {
+            begin = partition_left(begin, end, comp) + 1;
+            continue;
+        }
+
+        PartitionResult<Iter> result = partition<Branchless>(begin, end, comp);
+        Iter pivot_pos = result.pivot;
+
+        isize l_size = pivot_pos - begin;
+        isize r_size = end - (pivot_pos + 1);
+        bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+        if (highly_unbalanced) {
+            if (--bad_allowed == 0) {
+                heap_sort(begin, end, comp);
+                return;
+            }
+
+            /* shuffle some elements around to break patterns that produce bad pivots */
+            if (l_size >= insertion_sort_threshold) {
+                iter_swap(begin, begin + l_size / 4);
+                iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+
+                if (l_size > ninther_threshold) {
+                    iter_swap(begin + 1, begin + (l_size / 4 + 1));
+                    iter_swap(begin + 2, begin + (l_size / 4 + 2));
+                    iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                    iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+                }
+            }
+
+            if (r_size >= insertion_sort_threshold) {
+                iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                iter_swap(end - 1, end - r_size / 4);
+
+                if (r_size > ninther_threshold) {
+                    iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                    iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                    iter_swap(end - 2, end - (1 + r_size / 4));
+                    iter_swap(end - 3, end - (2 + r_size / 4));
+                }
+            }
+        } else if (result.already_partitioned && partial_insertion_sort(begin, pivot_pos, comp)
+                   && partial_insertion_sort(pivot_pos + 1, end, comp)) {
+            /* the input was (almost) sorted already */
+            return;
+        }
+
+        /* recurse into the left part, loop on the right part */
+        pdqsort_loop<Branchless>(begin, pivot_pos, comp, bad_allowed, leftmost);
+        begin = pivot_pos + 1;
+        leftmost = false;
+    }
+}
+
+template<typename Iter>
+constexpr void swap_range(Iter a, Iter b, isize count) {
+    for (isize i = 0; i < count; i++) {
+        iter_swap(a + i, b + i);
+    }
+}
+
+/**
+ * Rotates [a, b) so that `m` becomes the first element, using only swaps.
+ */
+template<typename Iter>
+constexpr void rotate(Iter begin, isize a, isize m, isize b) {
+    isize i = m - a;
+    isize j = b - m;
+
+    while (i != j) {
+        if (i > j) {
+            swap_range(begin + (m - i), begin + m, j);
+            i -= j;
+        } else {
+            swap_range(begin + (m - i), begin + (m + j - i), i);
+            j -= i;
+        }
+    }
+
+    swap_range(begin + (m - i), begin + m, i);
+}
+
+/**
+ * Merges the sorted ranges [a, m) and [m, b) in place.
+ *
+ * This is the SymMerge algorithm from "Stable Minimum Storage Merging by Symmetric Comparisons"
+ * (Kim, Kutzner). It needs O(log n) stack and no buffer.
+ */
+template<typename Iter, typename Compare>
+constexpr void sym_merge(Iter begin, isize a, isize m, isize b, Compare& comp) {
+    if (m - a == 1) {
+        /* binary search for the place of the single element on the left and rotate it there */
+        isize i = m;
+        isize j = b;
+        while (i < j) {
+            isize h = i + (j - i) / 2;
+            if (comp(begin[h], begin[a])) {
+                i = h + 1;
+            } else {
+                j = h;
+            }
+        }
+
+        for (isize k = a; k < i - 1; k++) {
+            iter_swap(begin + k, begin + (k + 1));
+        }
+        return;
+    }
+
+    if (b - m == 1) {
+        isize i = a;
+        isize j = m;
+        while (i < j) {
+            isize h = i + (j - i) / 2;
+            if (!comp(begin[m], begin[h])) {
+                i = h + 1;
+            } else {
+                j = h;
+            }
+        }
+
+        for (isize k = m; k > i; k--) {
+            iter_swap(begin + k, begin + (k - 1));
+        }
+        return;
+    }
+
+    isize mid = a + (b - a) / 2;
+    isize n = mid + m;
+    isize start;
+    isize r;
+
+    if (m > mid) {
+        start = n - b;
+        r = mid;
+    } else {
+        start = a;
+        r = m;
+    }
+
+    isize p = n - 1;
+    while (start < r) {
+        isize c = start + (r - start) / 2;
+        if (!comp(begin[p - c], begin[c])) {
+            start = c + 1;
+        } else {
+            r = c;
+        }
+    }
+
+    isize end = n - start;
+    if (start < m && m < end) {
+        rotate(begin, start, m, end);
+    }
+
+    if (a < start && start < mid) {
+        sym_merge(begin, a, start, mid, comp);
+    }
+
+    if (mid < end && end < b) {
+        sym_merge(begin, mid, end, b, comp);
+    }
+}
+
+/**
+ * Radix sort is only used for comparison free keys of these types.
+ */
+template<typename T>
+concept RadixKey = UnsignedIntegral<T>;
+
+/**
+ * Maps an integer onto an unsigned key with the same ordering.
+ */
+template<Integral T>
+ALWAYS_INLINE constexpr make_unsigned<T> radix_key(T value) noexcept {
+    using U = make_unsigned<T>;
+
+    if constexpr (is_signed<T>) {
+        return static_cast<U>(value) ^ (U(1) << (sizeof(U) * char_bits - 1));
+    } else {
+        return value;
+    }
+}
+
+} /* namespace Detail::Sort */
+
+/**
+ * Sorts [begin, end) with pattern-defeating quicksort.
+ *
+ * Runs in O(n log n) in the worst case and O(n) on sorted, reverse sorted and many-duplicate inputs.
+ * The sort is not stable. For arithmetic types with the default comparison a branchless
+ * block partition is used.
+ */
+template<WritableRandomAccessIterator Iter, typename Compare = Less>
+constexpr void sort(Iter begin, Iter end, Compare comp = {}) {
+    using T = ValueTypeOf<Iter>;
+
+    if (begin == end) {
+        return;
+    }
+
+    constexpr bool default_compare = is_same<Compare, Less> || is_same<Compare, Greater>;
+    constexpr bool branchless = default_compare && is_arithmetic<T>;
+
+    /* floor(log2(n)) bad partitions are tolerated before falling back to heap sort */
+    int bad_allowed = 0;
+    for (usize n = end - begin; n >>= 1;) {
+        bad_allowed++;
+    }
+
+    Detail::Sort::pdqsort_loop<branchless>(begin, end, comp, bad_allowed, true);
+}
+
+/**
+ * Sorts a range with pattern-defeating quicksort.
+ */
+template<typename Rng, typename Compare = Less>
+requires WritableRandomAccessRange<Rng>
+constexpr void sort(Rng&& range, Compare comp = {}) {
+    sort(rng::begin(range), rng::end(range), move(comp));
+}
+
+/**
+ * Sorts [begin, end) keeping the order of equal elements.
+ *
+ * Works in place without any allocation: insertion sort on small blocks followed by
+ * SymMerge passes. O(n log n) comparisons and O(n log^2 n) swaps.
+ */
+template<WritableRandomAccessIterator Iter, typename Compare = Less>
+constexpr void stable_sort(Iter begin, Iter end, Compare comp = {}) {
+    isize size = end - begin;
+    isize block = Detail::Sort::stable_block_size;
+
+    isize a = 0;
+    for (; a + block <= size; a += block) {
+        Detail::Sort::insertion_sort(begin + a, begin + (a + block), comp);
+    }
+    Detail::Sort::insertion_sort(begin + a, end, comp);
+
+    for (; block < size; block *= 2) {
+        a = 0;
+        for (; a + 2 * block <= size; a += 2 * block) {
+            Detail::Sort::sym_merge(begin, a, a + block, a + 2 * block, comp);
+        }
+
+        if (a + block < size) {
+            Detail::Sort::sym_merge(begin, a, a + block, size, comp);
+        }
+    }
+}
+
+/**
+ * Sorts a range keeping the order of equal elements.
+ */
+template<typename Rng, typename Compare = Less>
+requires WritableRandomAccessRange<Rng>
+constexpr void stable_sort(Rng&& range, Compare comp = {}) {
+    stable_sort(rng::begin(range), rng::end(range), move(comp));
+}
+
+/**
+ * Sorts `values` by the unsigned integer returned from `key` using a least significant digit radix sort.
+ *
+ * Takes one pass per key byte and skips passes in which all keys share the same byte.
+ * `scratch` must have at least as many elements as `values`. The sort is stable.
+ */
+template<typename T, typename KeyFunc>
+requires Detail::Sort::RadixKey<invoke_result<KeyFunc&, const T&>> && Movable<T>
+void radix_sort(Slice<T> values, Slice<T> scratch, KeyFunc key) {
+    using Key = invoke_result<KeyFunc&, const T&>;
+
+    VERIFY(scratch.size() >= values.size());
+
+    usize size = values.size();
+    T* src = values.data();
+    T* dst = scratch.data();
+
+    for (usize shift = 0; shift < sizeof(Key) * char_bits; shift += char_bits) {
+        usize counts[256] = {};
+
+        for (usize i = 0; i < size; i++) {
+            counts[(key(src[i]) >> shift) & 0xff]++;
+        }
+
+        /* every key has the same digit, this pass would not change the order */
+        if (size == 0 || counts[(key(src[0]) >> shift) & 0xff] == size) {
+            continue;
+        }
+
+        usize offset = 0;
+        for (usize digit = 0; digit < 256; digit++) {
+            usize count = counts[digit];
+            counts[digit] = offset;
+            offset += count;
+        }
+
+        for (usize i = 0; i < size; i++) {
+            dst[counts[(key(src[i]) >> shift) & 0xff]++] = move(src[i]);
+        }
+
+        swap(src, dst);
+    }
+
+    if (src != values.data()) {
+        for (usize i = 0; i < size; i++) {
+            values.data()[i] = move(src[i]);
+        }
+    }
+}
+
+/**
+ * Sorts integers using a least significant digit radix sort.
+ *
+ * `scratch` must have at least as many elements as `values`.
+ */
+template<Integral T>
+void radix_sort(Slice<T> values, Slice<T> scratch) {
+    radix_sort(values, scratch, [](const T& value) {
+        return Detail::Sort::radix_key(value);
+    });
+}
+
+} /* namespace yt */
+
+using yt::radix_sort;
+using yt::sort;
+using yt::stable_sort;
\ No newline at end of file
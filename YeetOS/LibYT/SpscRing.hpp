@@ -0,0 +1,235 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <New.hpp>
+#include <Slice.hpp>
+#include <Types.hpp>
+#include <Atomic.hpp>
+#include <Option.hpp>
+#include <Utility.hpp>
+#include <Platform.hpp>
+#include <Concepts.hpp>
+
+namespace yt {
+
+/**
+ * A lock-free ring buffer with exactly one producer and one consumer.
+ *
+ * The producer only writes `m_tail` and the consumer only writes `m_head`. Both indices live on their own
+ * cache line together with a cached copy of the other side's index, so the shared line is only read when
+ * the ring looks full (producer) or empty (consumer).
+ *
+ * @tparam T Type of the elements
+ * @tparam N Capacity of the ring, must be a power of two
+ */
+template<typename T, usize N>
+requires Destructible<T>
+class SpscRing {
+    NOT_COPYABLE(SpscRing);
+    NOT_MOVABLE(SpscRing);
+
+    static_assert(N > 0u && (N & (N - 1)) == 0u, "SpscRing capacity must be a power of two");
+
+public:
+    using ValueType = T;
+
+    SpscRing() noexcept = default;
+
+    ~SpscRing() {
+        usize head = m_head.load(MemoryOrder::Relaxed);
+        usize tail = m_tail.load(MemoryOrder::Relaxed);
+
+        for (; head != tail; head++) {
+            slot(head)->~T();
+        }
+    }
+
+    /**
+     * Returns the maximum number of elements.
+     */
+    NODISCARD ALWAYS_INLINE constexpr usize capacity() const noexcept {
+        return N;
+    }
+
+    /**
+     * Returns the number of elements.
+     *
+     * Only a snapshot if called while the other side is active.
+     */
+    NODISCARD ALWAYS_INLINE usize size() const noexcept {
+        return m_tail.load(MemoryOrder::Acquire) - m_head.load(MemoryOrder::Acquire);
+    }
+
+    NODISCARD ALWAYS_INLINE bool is_empty() const noexcept {
+        return size() == 0;
+    }
+
+    /**
+     * Constructs a new element at the back of the ring.
+     * Returns `false` if the ring is full.
+     *
+     * Must only be called by the producer.
+     */
+    template<typename... Args>
+    requires ConstructibleFrom<T, Args...>
+    NODISCARD ALWAYS_INLINE bool try_emplace(Args&&... args) noexcept(is_nothrow_constructible<T, Args...>) {
+        usize tail = m_tail.load(MemoryOrder::Relaxed);
+
+        if (producer_free(tail, 1) == 0) {
+            return false;
+        }
+
+        new (slot(tail)) T(forward<Args>(args)...);
+        m_tail.store(tail + 1, MemoryOrder::Release);
+        return true;
+    }
+
+    NODISCARD ALWAYS_INLINE bool try_push(const T& value) noexcept(is_nothrow_copy_constructible<T>) {
+        return try_emplace(value);
+    }
+
+    NODISCARD ALWAYS_INLINE bool try_push(T&& value) noexcept(is_nothrow_move_constructible<T>) {
+        return try_emplace(move(value));
+    }
+
+    /**
+     * Copies as many elements from `values` into the ring as there is space for.
+     * The elements are published with a single store.
+     * Returns the number of elements pushed.
+     *
+     * Must only be called by the producer.
+     */
+    usize push_batch(Slice<const T> values) noexcept(is_nothrow_copy_constructible<T>) requires CopyConstructible<T> {
+        usize tail = m_tail.load(MemoryOrder::Relaxed);
+        usize count = min(values.size(), producer_free(tail, values.size()));
+
+        for (usize i = 0; i < count; i++) {
+            new (slot(tail + i)) T(values.data()[i]);
+        }
+
+        if (count) {
+            m_tail.store(tail + count, MemoryOrder::Release);
+        }
+
+        return count;
+    }
+
+    /**
+     * Removes the element at the front of the ring.
+     * Returns an empty `Option` if the ring is empty.
+     *
+     * Must only be called by the consumer.
+     */
+    NODISCARD ALWAYS_INLINE Option<T> try_pop() noexcept(is_nothrow_move_constructible<T>) {
+        usize head = m_head.load(MemoryOrder::Relaxed);
+
+        if (consumer_available(head, 1) == 0) {
+            return {};
+        }
+
+        T* ptr = slot(head);
+        Option<T> result(move(*ptr));
+        ptr->~T();
+
+        m_head.store(head + 1, MemoryOrder::Release);
+        return result;
+    }
+
+    /**
+     * Moves as many elements as are available (up to `out.size()`) into `out`.
+     * The freed slots are handed back to the producer with a single store.
+     * Returns the number of elements popped.
+     *
+     * Must only be called by the consumer.
+     */
+    usize pop_batch(Slice<T> out) noexcept(is_nothrow_move_assignable<T>) requires Movable<T> {
+        usize head = m_head.load(MemoryOrder::Relaxed);
+        usize count = min(out.size(), consumer_available(head, out.size()));
+
+        for (usize i = 0; i < count; i++) {
+            T* ptr = slot(head + i);
+            out.data()[i] = move(*ptr);
+            ptr->~T();
+        }
+
+        if (count) {
+            m_head.store(head + count, MemoryOrder::Release);
+        }
+
+        return count;
+    }
+
+private:
+    /**
+     * Returns the number of free slots as seen by the producer.
+     * The consumer's index is only reloaded if the cached value has fewer than `wanted` free slots.
+     */
+    ALWAYS_INLINE usize producer_free(usize tail, usize wanted) noexcept {
+        usize free = N - (tail - m_cached_head);
+
+        if (free < wanted) {
+            m_cached_head = m_head.load(MemoryOrder::Acquire);
+            free = N - (tail - m_cached_head);
+        }
+
+        return free;
+    }
+
+    /**
+     * Returns the number of filled slots as seen by the consumer.
+     * The producer's index is only reloaded if the cached value has fewer than `wanted` elements.
+     */
+    ALWAYS_INLINE usize consumer_available(usize head, usize wanted) noexcept {
+        usize available = m_cached_tail - head;
+
+        if (available < wanted) {
+            m_cached_tail = m_tail.load(MemoryOrder::Acquire);
+            available = m_cached_tail - head;
+        }
+
+        return available;
+    }
+
+    ALWAYS_INLINE T* slot(usize index) noexcept {
+        return __builtin_launder(reinterpret_cast<T*>(m_storage + (index & (N - 1)) * sizeof(T)));
+    }
+
+private:
+    /* consumer side */
+    alignas(cache_line_size) Atomic<usize> m_head { 0 };
+    usize m_cached_tail { 0 };
+
+    /* producer side */
+    alignas(cache_line_size) Atomic<usize> m_tail { 0 };
+    usize m_cached_head { 0 };
+
+    alignas(cache_line_size) alignas(T) Byte m_storage[N * sizeof(T)];
+};
+
+} /* namespace yt */
+
+using yt::SpscRing;
\ No newline at end of file
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#include <string.h>
+
+#include <New.hpp>
+#include <String.hpp>
+#include <Utility.hpp>
+
+namespace yt {
+
+String::String(StringView view) : m_data(m_inline) {
+    m_inline[0] = '\0';
+    reserve(view.length());
+    memcpy(m_data, view.characters(), view.length());
+    m_length = view.length();
+    m_data[m_length] = '\0';
+}
+
+String::String(String&& other) noexcept : m_data(m_inline) {
+    take_storage(other);
+}
+
+String& String::operator=(const String& other) {
+    if (this != &other) {
+        clear();
+        append(other.view());
+    }
+    return *this;
+}
+
+String& String::operator=(String&& other) noexcept {
+    if (this != &other) {
+        release_storage();
+        take_storage(other);
+    }
+    return *this;
+}
+
+String::~String() {
+    release_storage();
+}
+
+void String::reserve(usize capacity) {
+    if (capacity <= m_capacity) {
+        return;
+    }
+
+    /* grow geometrically so that repeated appends stay amortized O(1) */
+    usize new_capacity = max(capacity, 2 * m_capacity);
+    char* new_data = static_cast<char*>(::operator new(new_capacity + 1));
+    memcpy(new_data, m_data, m_length + 1);
+
+    release_storage();
+
+    m_data = new_data;
+    m_capacity = new_capacity;
+}
+
+void String::append(StringView view) {
+    const char* source = view.characters();
+
+    /* `view` may point into our own buffer, which reserve() is about to free */
+    FlatPtr begin = reinterpret_cast<FlatPtr>(m_data);
+    FlatPtr address = reinterpret_cast<FlatPtr>(source);
+    if (address >= begin && address <= begin + m_length) {
+        usize offset = address - begin;
+        reserve(m_length + view.length());
+        source = m_data + offset;
+    } else {
+        reserve(m_length + view.length());
+    }
+
+    memcpy(m_data + m_length, source, view.length());
+    m_length += view.length();
+    m_data[m_length] = '\0';
+}
+
+void String::append(char c) {
+    reserve(m_length + 1);
+    m_data[m_length++] = c;
+    m_data[m_length] = '\0';
+}
+
+void String::take_storage(String& other) noexcept {
+    if (other.is_inline()) {
+        memcpy(m_inline, other.m_inline, other.m_length + 1);
+        m_data = m_inline;
+    } else {
+        m_data = other.m_data;
+    }
+
+    m_length = other.m_length;
+    m_capacity = other.m_capacity;
+
+    other.m_data = other.m_inline;
+    other.m_length = 0;
+    other.m_capacity = inline_capacity;
+    other.m_inline[0] = '\0';
+}
+
+void String::release_storage() noexcept {
+    if (!is_inline()) {
+        ::operator delete(m_data, m_capacity + 1);
+        m_data = m_inline;
+        m_capacity = inline_capacity;
+    }
+}
+
+} /* namespace yt */
\ No newline at end of file
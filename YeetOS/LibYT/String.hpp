@@ -0,0 +1,205 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Types.hpp>
+#include <Verify.hpp>
+#include <Platform.hpp>
+#include <HashCode.hpp>
+#include <StringView.hpp>
+
+namespace yt {
+
+/**
+ * An owning, null-terminated string.
+ *
+ * Strings of up to `inline_capacity` characters are stored inside the object itself and never
+ * touch the heap. `m_data` always points at the active storage, so reading a string never has
+ * to check where it lives.
+ */
+class String {
+
+public:
+    static constexpr usize inline_capacity = 23;
+
+    using ValueType = char;
+
+    using IteratorType = char*;
+    using ConstIteratorType = const char*;
+
+public:
+    ALWAYS_INLINE String() noexcept : m_data(m_inline) {
+        m_inline[0] = '\0';
+    }
+
+    String(StringView view);
+
+    ALWAYS_INLINE String(const char* cstring) : String(StringView(cstring)) {}
+
+    ALWAYS_INLINE String(const String& other) : String(other.view()) {}
+
+    String(String&& other) noexcept;
+
+    String& operator=(const String& other);
+    String& operator=(String&& other) noexcept;
+
+    ~String();
+
+    /**
+     * Returns the number of characters, not counting the null-terminator.
+     */
+    NODISCARD ALWAYS_INLINE usize length() const noexcept {
+        return m_length;
+    }
+
+    NODISCARD ALWAYS_INLINE usize size() const noexcept {
+        return m_length;
+    }
+
+    /**
+     * Returns the number of characters that fit without reallocating.
+     */
+    NODISCARD ALWAYS_INLINE usize capacity() const noexcept {
+        return m_capacity;
+    }
+
+    NODISCARD ALWAYS_INLINE bool is_empty() const noexcept {
+        return m_length == 0;
+    }
+
+    /**
+     * Returns `true` if the characters are stored inside the object.
+     */
+    NODISCARD ALWAYS_INLINE bool is_inline() const noexcept {
+        return m_data == m_inline;
+    }
+
+    NODISCARD ALWAYS_INLINE char* characters() noexcept {
+        return m_data;
+    }
+
+    /**
+     * Returns the null-terminated characters.
+     */
+    NODISCARD ALWAYS_INLINE const char* characters() const noexcept {
+        return m_data;
+    }
+
+    NODISCARD ALWAYS_INLINE char* data() noexcept {
+        return m_data;
+    }
+
+    NODISCARD ALWAYS_INLINE const char* data() const noexcept {
+        return m_data;
+    }
+
+    NODISCARD ALWAYS_INLINE IteratorType begin() noexcept {
+        return m_data;
+    }
+
+    NODISCARD ALWAYS_INLINE ConstIteratorType begin() const noexcept {
+        return m_data;
+    }
+
+    NODISCARD ALWAYS_INLINE IteratorType end() noexcept {
+        return m_data + m_length;
+    }
+
+    NODISCARD ALWAYS_INLINE ConstIteratorType end() const noexcept {
+        return m_data + m_length;
+    }
+
+    /**
+     * Returns the character at `index`.
+     *
+     * UB if `index` is out of bounds.
+     */
+    NODISCARD ALWAYS_INLINE char& operator[](usize index) noexcept {
+        VERIFY(index < m_length);
+        return m_data[index];
+    }
+
+    /**
+     * Returns the character at `index`.
+     *
+     * UB if `index` is out of bounds.
+     */
+    NODISCARD ALWAYS_INLINE char operator[](usize index) const noexcept {
+        VERIFY(index < m_length);
+        return m_data[index];
+    }
+
+    NODISCARD ALWAYS_INLINE StringView view() const noexcept {
+        return StringView(m_data, m_length);
+    }
+
+    ALWAYS_INLINE operator StringView() const noexcept {
+        return view();
+    }
+
+    /**
+     * Makes sure that at least `capacity` characters fit without reallocating.
+     */
+    void reserve(usize capacity);
+
+    void append(StringView view);
+
+    void append(char c);
+
+    /**
+     * Removes all characters but keeps the current storage.
+     */
+    ALWAYS_INLINE void clear() noexcept {
+        m_length = 0;
+        m_data[0] = '\0';
+    }
+
+    NODISCARD ALWAYS_INLINE bool operator==(StringView other) const noexcept {
+        return view() == other;
+    }
+
+    NODISCARD ALWAYS_INLINE bool operator!=(StringView other) const noexcept {
+        return view() != other;
+    }
+
+    NODISCARD ALWAYS_INLINE HashCode hash_code() const noexcept {
+        return view().hash_code();
+    }
+
+private:
+    void take_storage(String& other) noexcept;
+    void release_storage() noexcept;
+
+private:
+    char* m_data;
+    usize m_length { 0 };
+    usize m_capacity { inline_capacity };
+    char m_inline[inline_capacity + 1];
+};
+
+} /* namespace yt */
+
+using yt::String;
\ No newline at end of file
@@ -0,0 +1,365 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Types.hpp>
+#include <Option.hpp>
+#include <Verify.hpp>
+#include <Utility.hpp>
+#include <HashCode.hpp>
+#include <Platform.hpp>
+
+namespace yt {
+
+/**
+ * A non-owning view over a sequence of characters.
+ *
+ * The length is stored next to the pointer, so passing a `StringView` around never rescans the
+ * characters. The characters are not required to be null-terminated.
+ */
+class StringView {
+
+public:
+    using ValueType = char;
+
+    using IteratorType = const char*;
+    using ConstIteratorType = const char*;
+
+    class SplitRange;
+
+public:
+    ALWAYS_INLINE constexpr StringView() noexcept = default;
+
+    ALWAYS_INLINE constexpr StringView(const char* characters, usize length) noexcept :
+        m_characters(characters), m_length(length) {}
+
+    /**
+     * Creates a view over a null-terminated string.
+     */
+    ALWAYS_INLINE constexpr StringView(const char* cstring) noexcept :
+        m_characters(cstring), m_length(cstring ? __builtin_strlen(cstring) : 0) {}
+
+    /**
+     * Returns the number of characters.
+     */
+    NODISCARD ALWAYS_INLINE constexpr usize length() const noexcept {
+        return m_length;
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr usize size() const noexcept {
+        return m_length;
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr bool is_empty() const noexcept {
+        return m_length == 0;
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr bool is_null() const noexcept {
+        return m_characters == nullptr;
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr const char* characters() const noexcept {
+        return m_characters;
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr const char* data() const noexcept {
+        return m_characters;
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr ConstIteratorType begin() const noexcept {
+        return m_characters;
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr ConstIteratorType end() const noexcept {
+        return m_characters + m_length;
+    }
+
+    /**
+     * Returns the character at `index`.
+     *
+     * UB if `index` is out of bounds.
+     */
+    NODISCARD ALWAYS_INLINE constexpr char operator[](usize index) const noexcept {
+        VERIFY(index < m_length);
+        return m_characters[index];
+    }
+
+    /**
+     * Returns a view beginning at `start` with `length` characters.
+     *
+     * UB if `start + length > this->length()`
+     */
+    NODISCARD ALWAYS_INLINE constexpr StringView substring_view(usize start, usize length) const noexcept {
+        VERIFY(start + length <= m_length);
+        return StringView { m_characters + start, length };
+    }
+
+    /**
+     * Returns a view of everything from `start` to the end.
+     */
+    NODISCARD ALWAYS_INLINE constexpr StringView substring_view(usize start) const noexcept {
+        VERIFY(start <= m_length);
+        return StringView { m_characters + start, m_length - start };
+    }
+
+    NODISCARD constexpr bool starts_with(StringView prefix) const noexcept {
+        return prefix.m_length <= m_length && substring_view(0, prefix.m_length) == prefix;
+    }
+
+    NODISCARD constexpr bool starts_with(char c) const noexcept {
+        return m_length > 0 && m_characters[0] == c;
+    }
+
+    NODISCARD constexpr bool ends_with(StringView suffix) const noexcept {
+        return suffix.m_length <= m_length && substring_view(m_length - suffix.m_length) == suffix;
+    }
+
+    NODISCARD constexpr bool ends_with(char c) const noexcept {
+        return m_length > 0 && m_characters[m_length - 1] == c;
+    }
+
+    /**
+     * Returns the index of the first occurrence of `c` at or after `start`.
+     */
+    NODISCARD constexpr Option<usize> find(char c, usize start = 0) const noexcept {
+        usize index = find_index(c, start);
+        return index < m_length ? Option<usize>(index) : Option<usize>();
+    }
+
+    /**
+     * Returns the index of the first occurrence of `needle` at or after `start`.
+     */
+    NODISCARD constexpr Option<usize> find(StringView needle, usize start = 0) const noexcept {
+        usize index = find_index(needle, start);
+        return index <= m_length ? Option<usize>(index) : Option<usize>();
+    }
+
+    /**
+     * Returns the index of the last occurrence of `c`.
+     */
+    NODISCARD constexpr Option<usize> find_last(char c) const noexcept {
+        for (usize i = m_length; i > 0; i--) {
+            if (m_characters[i - 1] == c) {
+                return i - 1;
+            }
+        }
+        return {};
+    }
+
+    NODISCARD constexpr bool contains(char c) const noexcept {
+        return find_index(c, 0) < m_length;
+    }
+
+    NODISCARD constexpr bool contains(StringView needle) const noexcept {
+        return find_index(needle, 0) <= m_length;
+    }
+
+    /**
+     * Returns a lazy range over the parts of this view separated by `separator`.
+     * Empty parts are skipped, so `"a  b"` split at `' '` yields `"a"` and `"b"`.
+     */
+    NODISCARD constexpr SplitRange split(char separator) const noexcept;
+
+    /**
+     * Returns a view without leading and trailing whitespace.
+     */
+    NODISCARD constexpr StringView trim_whitespace() const noexcept {
+        usize start = 0;
+        usize end = m_length;
+
+        while (start < end && is_whitespace(m_characters[start])) {
+            start++;
+        }
+
+        while (end > start && is_whitespace(m_characters[end - 1])) {
+            end--;
+        }
+
+        return substring_view(start, end - start);
+    }
+
+    NODISCARD constexpr bool operator==(StringView other) const noexcept {
+        if (m_length != other.m_length) {
+            return false;
+        }
+
+        for (usize i = 0; i < m_length; i++) {
+            if (m_characters[i] != other.m_characters[i]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    NODISCARD constexpr bool operator!=(StringView other) const noexcept {
+        return !(*this == other);
+    }
+
+    NODISCARD constexpr HashCode hash_code() const noexcept {
+        u32 hash = 0;
+        for (usize i = 0; i < m_length; i++) {
+            hash = (hash ^ static_cast<u8>(m_characters[i])) * 16777619u;
+        }
+        return yt::hash_code(hash);
+    }
+
+private:
+    /**
+     * Returns the index of the first `c` at or after `start`, or `length()` if there is none.
+     */
+    constexpr usize find_index(char c, usize start) const noexcept {
+        for (usize i = start; i < m_length; i++) {
+            if (m_characters[i] == c) {
+                return i;
+            }
+        }
+        return m_length;
+    }
+
+    /**
+     * Returns the index of the first `needle` at or after `start`, or a value past `length()` if there is none.
+     */
+    constexpr usize find_index(StringView needle, usize start) const noexcept {
+        if (needle.m_length > m_length || start > m_length - needle.m_length) {
+            return m_length + 1;
+        }
+
+        if (needle.is_empty()) {
+            return start;
+        }
+
+        for (usize i = start; i <= m_length - needle.m_length; i++) {
+            i = find_index(needle.m_characters[0], i);
+
+            if (i > m_length - needle.m_length) {
+                break;
+            }
+
+            if (substring_view(i, needle.m_length) == needle) {
+                return i;
+            }
+        }
+
+        return m_length + 1;
+    }
+
+    static constexpr bool is_whitespace(char c) noexcept {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+private:
+    const char* m_characters { nullptr };
+    usize m_length { 0 };
+};
+
+class StringView::SplitRange {
+
+public:
+    class Iterator {
+
+    public:
+        ALWAYS_INLINE constexpr Iterator(StringView remaining, char separator) noexcept :
+            m_remaining(remaining), m_separator(separator) {
+            advance();
+        }
+
+        NODISCARD ALWAYS_INLINE constexpr StringView operator*() const noexcept {
+            return m_current;
+        }
+
+        ALWAYS_INLINE constexpr Iterator& operator++() noexcept {
+            advance();
+            return *this;
+        }
+
+        NODISCARD ALWAYS_INLINE constexpr bool operator==(const Iterator& other) const noexcept {
+            return m_current.characters() == other.m_current.characters();
+        }
+
+        NODISCARD ALWAYS_INLINE constexpr bool operator!=(const Iterator& other) const noexcept {
+            return !(*this == other);
+        }
+
+    private:
+        constexpr void advance() noexcept {
+            while (m_remaining.starts_with(m_separator)) {
+                m_remaining = m_remaining.substring_view(1);
+            }
+
+            if (m_remaining.is_empty()) {
+                m_current = {};
+                return;
+            }
+
+            usize length = 0;
+            while (length < m_remaining.length() && m_remaining[length] != m_separator) {
+                length++;
+            }
+
+            m_current = m_remaining.substring_view(0, length);
+            m_remaining = m_remaining.substring_view(length);
+        }
+
+    private:
+        StringView m_current {};
+        StringView m_remaining;
+        char m_separator;
+    };
+
+public:
+    ALWAYS_INLINE constexpr SplitRange(StringView view, char separator) noexcept :
+        m_view(view), m_separator(separator) {}
+
+    NODISCARD ALWAYS_INLINE constexpr Iterator begin() const noexcept {
+        return Iterator(m_view, m_separator);
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr Iterator end() const noexcept {
+        return Iterator(StringView {}, m_separator);
+    }
+
+private:
+    StringView m_view;
+    char m_separator;
+};
+
+constexpr StringView::SplitRange StringView::split(char separator) const noexcept {
+    return SplitRange(*this, separator);
+}
+
+namespace literals {
+
+constexpr StringView operator""_sv(const char* characters, usize length) noexcept {
+    return StringView(characters, length);
+}
+
+} /* namespace literals */
+
+} /* namespace yt */
+
+using yt::literals::operator""_sv;
+using yt::StringView;
\ No newline at end of file
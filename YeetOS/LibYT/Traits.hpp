@@ -26,6 +26,7 @@
 #pragma once
 
 #include <Types.hpp>
+#include <Platform.hpp>
 #include <TypeMagic.hpp>
 
 namespace yt {
@@ -74,8 +75,80 @@ concept HasUnderlyingTypeTraits = requires {
     typename ValuePointerOf<T>;
 };
 
+/**
+ * No object is ever placed in the first page of the address space,
+ * so addresses below this limit can be used to encode other states.
+ */
+inline constexpr FlatPtr niche_address_limit = 4096;
+
+/**
+ * Describes the bit patterns a type never uses for a valid value (its niche).
+ *
+ * Wrappers like `ErrorOr` use these to encode their own state inside the payload,
+ * without storing a separate flag. Types with a niche specialize this struct and provide:
+ *  - `niche_count`: the number of spare bit patterns.
+ *  - `store_niche(storage, index)`: writes the spare pattern `index` into uninitialized storage.
+ *  - `niche_index(storage)`: returns the index of the spare pattern in storage,
+ *     or a value `>= niche_count` if it holds a valid object.
+ *
+ * Enums with unused values can opt in by specializing this struct as well.
+ */
+template<typename T>
+struct NicheTraits {
+    static constexpr usize niche_count = 0;
+};
+
+namespace Detail {
+
+/**
+ * Niche of pointer-like types, the addresses from `first` up to `niche_address_limit`.
+ */
+template<FlatPtr first>
+struct AddressNicheTraits {
+    static constexpr usize niche_count = niche_address_limit - first;
+
+    ALWAYS_INLINE static void store_niche(void* storage, usize index) noexcept {
+        FlatPtr address = first + index;
+        __builtin_memcpy(storage, &address, sizeof(address));
+    }
+
+    ALWAYS_INLINE static usize niche_index(const void* storage) noexcept {
+        FlatPtr address;
+        __builtin_memcpy(&address, storage, sizeof(address));
+        return address - first;
+    }
+};
+
+} /* namespace Detail */
+
+/* null is a valid raw pointer, only the rest of the first page is spare */
+template<typename T>
+struct NicheTraits<T*> : Detail::AddressNicheTraits<1> {};
+
+/* a bool only ever holds 0 or 1 */
+template<>
+struct NicheTraits<bool> {
+    static constexpr usize niche_count = 254;
+
+    ALWAYS_INLINE static void store_niche(void* storage, usize index) noexcept {
+        u8 byte = static_cast<u8>(2 + index);
+        __builtin_memcpy(storage, &byte, sizeof(byte));
+    }
+
+    ALWAYS_INLINE static usize niche_index(const void* storage) noexcept {
+        u8 byte;
+        __builtin_memcpy(&byte, storage, sizeof(byte));
+        return static_cast<usize>(byte) - 2;
+    }
+};
+
+template<typename T>
+concept HasNiche = NicheTraits<remove_cv<T>>::niche_count > 0;
+
 } /* namespace yt */
 
+using yt::HasNiche;
+using yt::NicheTraits;
 using yt::UnderlyingTypeTraits;
 using yt::ValuePointerOf;
 using yt::ValueReferenceOf;
@@ -687,6 +687,13 @@ inline constexpr bool is_trivial = __is_trivial(T);
 template<typename T>
 inline constexpr bool is_trivially_copyable = __is_trivially_copyable(T);
 
+/**
+ * Whether two objects of a type are equal exactly when their bytes are equal.
+ * Floating point types are excluded since `0.0 == -0.0` and `NaN != NaN`.
+ */
+template<typename T>
+inline constexpr bool is_trivially_comparable = is_integral<T> || is_enum<T> || is_pointer<T>;
+
 template<typename T>
 inline constexpr bool is_standard_layout = __is_standard_layout(T);
 
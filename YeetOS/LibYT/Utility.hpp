@@ -68,6 +68,26 @@ constexpr T exchange(T& obj,
     return old_value;
 }
 
+/**
+ * Function object that compares with `<`, the default ordering of all algorithms.
+ */
+struct Less {
+    template<typename T, typename U>
+    ALWAYS_INLINE constexpr bool operator()(const T& a, const U& b) const noexcept(noexcept(a < b)) {
+        return a < b;
+    }
+};
+
+/**
+ * Function object that compares with `>`.
+ */
+struct Greater {
+    template<typename T, typename U>
+    ALWAYS_INLINE constexpr bool operator()(const T& a, const U& b) const noexcept(noexcept(a > b)) {
+        return a > b;
+    }
+};
+
 /* clang-format off */
 template<typename To, typename From>
 requires (is_trivially_copyable<To> && is_trivially_copyable<From> && sizeof(To) == sizeof(From))
@@ -96,6 +116,8 @@ using yt::align_up;
 using yt::bit_cast;
 using yt::exchange;
 using yt::forward;
+using yt::Greater;
+using yt::Less;
 using yt::log2;
 using yt::move;
 using yt::swap;
@@ -0,0 +1,615 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Slice.hpp>
+#include <Types.hpp>
+#include <Invoke.hpp>
+#include <Ranges.hpp>
+#include <Utility.hpp>
+#include <Concepts.hpp>
+#include <Platform.hpp>
+
+namespace yt {
+
+/**
+ * Base class of all views.
+ *
+ * A view lazily produces the elements of another range, nothing is computed or copied
+ * until its iterators are dereferenced. Views are cheap to move and can be stacked
+ * with `|` without creating intermediate buffers.
+ */
+struct ViewBase {};
+
+/**
+ * Whether a range type can be used as a view. Types that do not own their elements,
+ * like `Slice`, are cheap to copy and need not be wrapped in a `RefView`.
+ */
+template<typename T>
+inline constexpr bool enable_view = DerivedFrom<T, ViewBase>;
+
+template<typename T>
+inline constexpr bool enable_view<Slice<T>> = true;
+
+template<typename T>
+concept View = Range<T> && enable_view<T> && MoveConstructible<T>;
+
+/**
+ * A view of all elements of an lvalue range, which has to outlive the view.
+ */
+template<typename Rng>
+requires Range<Rng>
+class RefView : public ViewBase {
+
+public:
+    ALWAYS_INLINE constexpr RefView(Rng& range) noexcept : m_range(addr_of(range)) {}
+
+    NODISCARD ALWAYS_INLINE constexpr auto begin() const {
+        return rng::begin(*m_range);
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr auto end() const {
+        return rng::end(*m_range);
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr usize size() const requires Sized<Rng> {
+        return rng::size(*m_range);
+    }
+
+private:
+    Rng* m_range;
+};
+
+namespace views {
+
+/**
+ * Returns a view of all elements of a range.
+ * Views are passed through, other ranges are referred to and must therefore be lvalues.
+ */
+template<typename Rng>
+constexpr auto all(Rng&& range) {
+    if constexpr (View<remove_cvref<Rng>>) {
+        return remove_cvref<Rng>(forward<Rng>(range));
+    } else {
+        static_assert(is_lvalue_reference<Rng>, "views can only refer to lvalue ranges");
+        return RefView<remove_reference<Rng>>(range);
+    }
+}
+
+} /* namespace views */
+
+template<typename Rng>
+using AllView = decltype(views::all(declval<Rng>()));
+
+namespace Detail {
+
+/**
+ * Turns a range into a view when used as `range | adaptor` or `adaptor(range)`.
+ */
+template<typename MakeView>
+struct RangeAdaptor {
+    MakeView make_view;
+
+    template<typename Rng>
+    requires Range<remove_reference<Rng>>
+    NODISCARD ALWAYS_INLINE constexpr auto operator()(Rng&& range) const {
+        return make_view(forward<Rng>(range));
+    }
+};
+
+template<typename MakeView>
+RangeAdaptor(MakeView) -> RangeAdaptor<MakeView>;
+
+template<typename Rng, typename MakeView>
+requires Range<remove_reference<Rng>>
+NODISCARD ALWAYS_INLINE constexpr auto operator|(Rng&& range, const RangeAdaptor<MakeView>& adaptor) {
+    return adaptor(forward<Rng>(range));
+}
+
+} /* namespace Detail */
+
+/**
+ * A view of the results of calling a function on each element of another view.
+ */
+template<View V, typename Func>
+class MapView : public ViewBase {
+
+public:
+    class SentinelType;
+
+    class IteratorType {
+        friend class MapView;
+        friend class SentinelType;
+
+    public:
+        using BaseIterator = IteratorOf<V>;
+        using ValueType = remove_cvref<invoke_result<Func&, decltype(*declval<BaseIterator&>())>>;
+
+        ALWAYS_INLINE constexpr decltype(auto) operator*() const {
+            return invoke(m_parent->m_func, *m_current);
+        }
+
+        ALWAYS_INLINE constexpr IteratorType& operator++() {
+            ++m_current;
+            return *this;
+        }
+
+        ALWAYS_INLINE constexpr IteratorType operator++(int) {
+            IteratorType temp = *this;
+            ++m_current;
+            return temp;
+        }
+
+        ALWAYS_INLINE constexpr bool operator==(const IteratorType& other) const {
+            return m_current == other.m_current;
+        }
+
+    private:
+        ALWAYS_INLINE constexpr IteratorType(MapView* parent, BaseIterator current)
+            : m_parent(parent), m_current(move(current)) {}
+
+    private:
+        MapView* m_parent;
+        BaseIterator m_current;
+    };
+
+    class SentinelType {
+        friend class MapView;
+
+    public:
+        ALWAYS_INLINE constexpr bool operator==(const IteratorType& it) const {
+            return it.m_current == m_end;
+        }
+
+    private:
+        ALWAYS_INLINE constexpr explicit SentinelType(SentinelOf<V> end) : m_end(move(end)) {}
+
+    private:
+        SentinelOf<V> m_end;
+    };
+
+    ALWAYS_INLINE constexpr MapView(V base, Func func) : m_base(move(base)), m_func(move(func)) {}
+
+    NODISCARD ALWAYS_INLINE constexpr IteratorType begin() {
+        return IteratorType(this, rng::begin(m_base));
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr SentinelType end() {
+        return SentinelType(rng::end(m_base));
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr usize size() requires Sized<V> {
+        return rng::size(m_base);
+    }
+
+private:
+    V m_base;
+    Func m_func;
+};
+
+/**
+ * A view of the elements of another view that satisfy a predicate.
+ */
+template<View V, typename Pred>
+class FilterView : public ViewBase {
+
+public:
+    class SentinelType;
+
+    class IteratorType {
+        friend class FilterView;
+        friend class SentinelType;
+
+    public:
+        using BaseIterator = IteratorOf<V>;
+        using ValueType = ValueTypeOf<BaseIterator>;
+
+        ALWAYS_INLINE constexpr decltype(auto) operator*() const {
+            return *m_current;
+        }
+
+        ALWAYS_INLINE constexpr IteratorType& operator++() {
+            ++m_current;
+            skip_rejected();
+            return *this;
+        }
+
+        ALWAYS_INLINE constexpr IteratorType operator++(int) {
+            IteratorType temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        ALWAYS_INLINE constexpr bool operator==(const IteratorType& other) const {
+            return m_current == other.m_current;
+        }
+
+    private:
+        ALWAYS_INLINE constexpr IteratorType(FilterView* parent, BaseIterator current, SentinelOf<V> end)
+            : m_parent(parent), m_current(move(current)), m_end(move(end)) {
+            skip_rejected();
+        }
+
+        ALWAYS_INLINE constexpr void skip_rejected() {
+            while (m_current != m_end && !invoke(m_parent->m_pred, *m_current)) {
+                ++m_current;
+            }
+        }
+
+    private:
+        FilterView* m_parent;
+        BaseIterator m_current;
+        SentinelOf<V> m_end;
+    };
+
+    class SentinelType {
+        friend class FilterView;
+
+    public:
+        ALWAYS_INLINE constexpr bool operator==(const IteratorType& it) const {
+            return it.m_current == m_end;
+        }
+
+    private:
+        ALWAYS_INLINE constexpr explicit SentinelType(SentinelOf<V> end) : m_end(move(end)) {}
+
+    private:
+        SentinelOf<V> m_end;
+    };
+
+    ALWAYS_INLINE constexpr FilterView(V base, Pred pred) : m_base(move(base)), m_pred(move(pred)) {}
+
+    NODISCARD ALWAYS_INLINE constexpr IteratorType begin() {
+        return IteratorType(this, rng::begin(m_base), rng::end(m_base));
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr SentinelType end() {
+        return SentinelType(rng::end(m_base));
+    }
+
+private:
+    V m_base;
+    Pred m_pred;
+};
+
+/**
+ * A view of at most the first `count` elements of another view.
+ */
+template<View V>
+class TakeView : public ViewBase {
+
+public:
+    class SentinelType;
+
+    class IteratorType {
+        friend class TakeView;
+        friend class SentinelType;
+
+    public:
+        using BaseIterator = IteratorOf<V>;
+        using ValueType = ValueTypeOf<BaseIterator>;
+
+        ALWAYS_INLINE constexpr decltype(auto) operator*() const {
+            return *m_current;
+        }
+
+        ALWAYS_INLINE constexpr IteratorType& operator++() {
+            ++m_current;
+            --m_remaining;
+            return *this;
+        }
+
+        ALWAYS_INLINE constexpr IteratorType operator++(int) {
+            IteratorType temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        ALWAYS_INLINE constexpr bool operator==(const IteratorType& other) const {
+            return m_current == other.m_current;
+        }
+
+    private:
+        ALWAYS_INLINE constexpr IteratorType(BaseIterator current, usize remaining)
+            : m_current(move(current)), m_remaining(remaining) {}
+
+    private:
+        BaseIterator m_current;
+        usize m_remaining;
+    };
+
+    class SentinelType {
+        friend class TakeView;
+
+    public:
+        ALWAYS_INLINE constexpr bool operator==(const IteratorType& it) const {
+            return it.m_remaining == 0 || it.m_current == m_end;
+        }
+
+    private:
+        ALWAYS_INLINE constexpr explicit SentinelType(SentinelOf<V> end) : m_end(move(end)) {}
+
+    private:
+        SentinelOf<V> m_end;
+    };
+
+    ALWAYS_INLINE constexpr TakeView(V base, usize count) : m_base(move(base)), m_count(count) {}
+
+    NODISCARD ALWAYS_INLINE constexpr IteratorType begin() {
+        return IteratorType(rng::begin(m_base), m_count);
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr SentinelType end() {
+        return SentinelType(rng::end(m_base));
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr usize size() requires Sized<V> {
+        return min(rng::size(m_base), m_count);
+    }
+
+private:
+    V m_base;
+    usize m_count;
+};
+
+/**
+ * An element of an `EnumerateView`, usually taken apart with a structured binding.
+ */
+template<typename Ref>
+struct EnumerateItem {
+    usize index;
+    Ref value;
+};
+
+/**
+ * A view of the elements of another view together with their index.
+ */
+template<View V>
+class EnumerateView : public ViewBase {
+
+public:
+    class SentinelType;
+
+    class IteratorType {
+        friend class EnumerateView;
+        friend class SentinelType;
+
+    public:
+        using BaseIterator = IteratorOf<V>;
+        using ValueType = EnumerateItem<decltype(*declval<BaseIterator&>())>;
+
+        ALWAYS_INLINE constexpr ValueType operator*() const {
+            return { m_index, *m_current };
+        }
+
+        ALWAYS_INLINE constexpr IteratorType& operator++() {
+            ++m_current;
+            ++m_index;
+            return *this;
+        }
+
+        ALWAYS_INLINE constexpr IteratorType operator++(int) {
+            IteratorType temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        ALWAYS_INLINE constexpr bool operator==(const IteratorType& other) const {
+            return m_current == other.m_current;
+        }
+
+    private:
+        ALWAYS_INLINE constexpr explicit IteratorType(BaseIterator current) : m_current(move(current)) {}
+
+    private:
+        BaseIterator m_current;
+        usize m_index { 0 };
+    };
+
+    class SentinelType {
+        friend class EnumerateView;
+
+    public:
+        ALWAYS_INLINE constexpr bool operator==(const IteratorType& it) const {
+            return it.m_current == m_end;
+        }
+
+    private:
+        ALWAYS_INLINE constexpr explicit SentinelType(SentinelOf<V> end) : m_end(move(end)) {}
+
+    private:
+        SentinelOf<V> m_end;
+    };
+
+    ALWAYS_INLINE constexpr explicit EnumerateView(V base) : m_base(move(base)) {}
+
+    NODISCARD ALWAYS_INLINE constexpr IteratorType begin() {
+        return IteratorType(rng::begin(m_base));
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr SentinelType end() {
+        return SentinelType(rng::end(m_base));
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr usize size() requires Sized<V> {
+        return rng::size(m_base);
+    }
+
+private:
+    V m_base;
+};
+
+/**
+ * An element of a `ZipView`.
+ */
+template<typename First, typename Second>
+struct ZipItem {
+    First first;
+    Second second;
+};
+
+/**
+ * A view of the elements of two views in lockstep, ending with the shorter one.
+ */
+template<View V1, View V2>
+class ZipView : public ViewBase {
+
+public:
+    class SentinelType;
+
+    class IteratorType {
+        friend class ZipView;
+        friend class SentinelType;
+
+    public:
+        using FirstIterator = IteratorOf<V1>;
+        using SecondIterator = IteratorOf<V2>;
+        using ValueType = ZipItem<decltype(*declval<FirstIterator&>()), decltype(*declval<SecondIterator&>())>;
+
+        ALWAYS_INLINE constexpr ValueType operator*() const {
+            return { *m_first, *m_second };
+        }
+
+        ALWAYS_INLINE constexpr IteratorType& operator++() {
+            ++m_first;
+            ++m_second;
+            return *this;
+        }
+
+        ALWAYS_INLINE constexpr IteratorType operator++(int) {
+            IteratorType temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        ALWAYS_INLINE constexpr bool operator==(const IteratorType& other) const {
+            return m_first == other.m_first && m_second == other.m_second;
+        }
+
+    private:
+        ALWAYS_INLINE constexpr IteratorType(FirstIterator first, SecondIterator second)
+            : m_first(move(first)), m_second(move(second)) {}
+
+    private:
+        FirstIterator m_first;
+        SecondIterator m_second;
+    };
+
+    class SentinelType {
+        friend class ZipView;
+
+    public:
+        ALWAYS_INLINE constexpr bool operator==(const IteratorType& it) const {
+            return it.m_first == m_first_end || it.m_second == m_second_end;
+        }
+
+    private:
+        ALWAYS_INLINE constexpr SentinelType(SentinelOf<V1> first_end, SentinelOf<V2> second_end)
+            : m_first_end(move(first_end)), m_second_end(move(second_end)) {}
+
+    private:
+        SentinelOf<V1> m_first_end;
+        SentinelOf<V2> m_second_end;
+    };
+
+    ALWAYS_INLINE constexpr ZipView(V1 first, V2 second) : m_first(move(first)), m_second(move(second)) {}
+
+    NODISCARD ALWAYS_INLINE constexpr IteratorType begin() {
+        return IteratorType(rng::begin(m_first), rng::begin(m_second));
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr SentinelType end() {
+        return SentinelType(rng::end(m_first), rng::end(m_second));
+    }
+
+    NODISCARD ALWAYS_INLINE constexpr usize size() requires Sized<V1> && Sized<V2> {
+        return min(rng::size(m_first), rng::size(m_second));
+    }
+
+private:
+    V1 m_first;
+    V2 m_second;
+};
+
+namespace views {
+
+/**
+ * Lazily applies `func` to each element: `range | views::map(func)`.
+ */
+template<typename Func>
+NODISCARD constexpr auto map(Func func) {
+    return Detail::RangeAdaptor { [func = move(func)]<typename Rng>(Rng&& range) {
+        return MapView<AllView<Rng>, Func>(all(forward<Rng>(range)), func);
+    } };
+}
+
+/**
+ * Lazily skips the elements not satisfying `pred`: `range | views::filter(pred)`.
+ */
+template<typename Pred>
+NODISCARD constexpr auto filter(Pred pred) {
+    return Detail::RangeAdaptor { [pred = move(pred)]<typename Rng>(Rng&& range) {
+        return FilterView<AllView<Rng>, Pred>(all(forward<Rng>(range)), pred);
+    } };
+}
+
+/**
+ * Stops after the first `count` elements: `range | views::take(count)`.
+ */
+NODISCARD constexpr auto take(usize count) {
+    return Detail::RangeAdaptor { [count]<typename Rng>(Rng&& range) {
+        return TakeView<AllView<Rng>>(all(forward<Rng>(range)), count);
+    } };
+}
+
+/**
+ * Pairs each element with its index: `for (auto [index, value] : range | views::enumerate)`.
+ */
+inline constexpr Detail::RangeAdaptor enumerate { []<typename Rng>(Rng&& range) {
+    return EnumerateView<AllView<Rng>>(all(forward<Rng>(range)));
+} };
+
+/**
+ * Walks two ranges in lockstep: `for (auto [a, b] : views::zip(first, second))`.
+ */
+template<typename Rng1, typename Rng2>
+requires Range<remove_reference<Rng1>> && Range<remove_reference<Rng2>>
+NODISCARD constexpr auto zip(Rng1&& first, Rng2&& second) {
+    return ZipView<AllView<Rng1>, AllView<Rng2>>(all(forward<Rng1>(first)), all(forward<Rng2>(second)));
+}
+
+} /* namespace views */
+
+} /* namespace yt */
+
+namespace views = yt::views;
+using yt::EnumerateView;
+using yt::FilterView;
+using yt::MapView;
+using yt::RefView;
+using yt::TakeView;
+using yt::View;
+using yt::ZipView;
\ No newline at end of file
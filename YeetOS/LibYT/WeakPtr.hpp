@@ -0,0 +1,128 @@
+/*
+ * Copyright 2022 Malte Dömer
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE
+ */
+
+#pragma once
+
+#include <Option.hpp>
+#include <RefPtr.hpp>
+#include <Utility.hpp>
+#include <Platform.hpp>
+#include <RefCounted.hpp>
+
+namespace yt {
+
+/**
+ * A non-owning reference to a `RefCounted` object that does not keep it alive.
+ *
+ * All `WeakPtr`s to an object share a small control block, which the object only allocates
+ * once the first `WeakPtr` to it is created. Objects that are never weakly referenced pay
+ * for a single null pointer.
+ *
+ * @tparam T the underlying type, derived from `RefCounted<T>`.
+ */
+template<typename T>
+class WeakPtr {
+
+public:
+    using ValueType = T;
+
+    ALWAYS_INLINE WeakPtr() noexcept = default;
+
+    ALWAYS_INLINE WeakPtr(const T& object) : m_link(static_cast<const RefCounted<T>&>(object).ensure_weak_link()) {
+        m_link->ref();
+    }
+
+    ALWAYS_INLINE WeakPtr(const RefPtr<T>& ptr) : WeakPtr(*ptr) {}
+
+    ALWAYS_INLINE WeakPtr(const WeakPtr& other) noexcept : m_link(other.m_link) {
+        if (m_link) {
+            m_link->ref();
+        }
+    }
+
+    ALWAYS_INLINE WeakPtr(WeakPtr&& other) noexcept : m_link(exchange(other.m_link, nullptr)) {}
+
+    ALWAYS_INLINE WeakPtr& operator=(const WeakPtr& other) noexcept {
+        WeakPtr ptr(other);
+        swap(ptr);
+        return *this;
+    }
+
+    ALWAYS_INLINE WeakPtr& operator=(WeakPtr&& other) noexcept {
+        WeakPtr ptr(move(other));
+        swap(ptr);
+        return *this;
+    }
+
+    ~WeakPtr() {
+        clear();
+    }
+
+    /**
+     * Returns a strong reference to the object if it is still alive.
+     */
+    NODISCARD Option<RefPtr<T>> strong_ref() const noexcept {
+        if (!m_link) {
+            return {};
+        }
+
+        if (T* ptr = m_link->template try_ref_object<T>()) {
+            return RefPtr<T>(RefPtr<T>::Adopt, *ptr);
+        }
+
+        return {};
+    }
+
+    /**
+     * Returns whether the object is gone. A `false` result may be stale by the time it is used.
+     */
+    NODISCARD ALWAYS_INLINE bool is_null() const noexcept {
+        return !m_link || m_link->is_revoked();
+    }
+
+    ALWAYS_INLINE void swap(WeakPtr& other) noexcept {
+        ::swap(m_link, other.m_link);
+    }
+
+    ALWAYS_INLINE void clear() noexcept {
+        if (m_link) {
+            m_link->unref();
+            m_link = nullptr;
+        }
+    }
+
+private:
+    Detail::WeakLink* m_link { nullptr };
+};
+
+template<typename T>
+ALWAYS_INLINE WeakPtr<T> make_weak_ptr(const T& object) {
+    return WeakPtr<T>(object);
+}
+
+} /* namespace yt */
+
+using yt::make_weak_ptr;
+using yt::WeakPtr;
\ No newline at end of file
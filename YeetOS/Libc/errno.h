@@ -106,6 +106,8 @@
 #define EWOULDBLOCK     85 /* Operation would block*/
 #define EXDEV           86 /* Cross-device link*/
 
+#define ELAST           86 /* Largest error number*/
+
 __BEGIN_DECLS
 
 int* get_errno_ptr();
@@ -23,21 +23,154 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <errno.h>
 #include <pthread.h>
 #include <assert.h>
 
+#include <Types.hpp>
+#include <Platform.hpp>
+
+#include <Kernel/WaitQueue.hpp>
+#include <Kernel/Arch/Processor.hpp>
+
 namespace {
 
-void* thread_data_table[64];
-int free_entry = 0;
+/**
+ * Thread-specific data of one thread, GS points to the block of the running thread.
+ * `values` must stay at offset 0 so that a key's value is a single %gs relative access.
+ */
+struct ThreadSpecificData {
+    void* values[PTHREAD_KEYS_MAX];
+    ThreadSpecificData* next;
+};
+
+struct KeySlot {
+    bool in_use;
+    void (*destructor)(void*);
+};
+
+static_assert(sizeof(void*) == 4, "%gs relative accesses below assume 4 byte slots");
+
+KeySlot key_slots[PTHREAD_KEYS_MAX];
+pthread_mutex_t key_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Blocks of all threads, a new key has to be cleared in each of them. */
+ThreadSpecificData* thread_data_list = nullptr;
+
+/* Block of the thread that booted the kernel, the only thread until there is a scheduler. */
+ThreadSpecificData initial_thread_data;
+
+ALWAYS_INLINE void* load_thread_value(pthread_key_t key) {
+    void* value;
+    asm volatile("movl %%gs:(,%1,4), %0" : "=r"(value) : "r"(key) : "memory");
+    return value;
+}
 
+ALWAYS_INLINE void store_thread_value(pthread_key_t key, void* value) {
+    asm volatile("movl %1, %%gs:(,%0,4)" ::"r"(key), "r"(value) : "memory");
 }
 
-int pthread_key_create(pthread_key_t* key, void (*)(void*)) {
-    assert(free_entry < 64);
+/* States of a pthread_mutex_t, unlock() only has to wake someone if the mutex was contended. */
+constexpr int mutex_unlocked = 0;
+constexpr int mutex_locked = 1;
+constexpr int mutex_contended = 2;
 
-    *key = free_entry;
-    free_entry++;
+/* Number of times a contended lock retries before it starts waiting. */
+constexpr int mutex_spin_count = 100;
+
+/* Number of wait queues that mutex and condition variable waiters are hashed into. */
+constexpr usize wait_queue_count = 64;
+
+Kernel::WaitQueue wait_queues[wait_queue_count];
+
+Kernel::WaitQueue& wait_queue_for(const int* address) {
+    FlatPtr value = reinterpret_cast<FlatPtr>(address);
+    return wait_queues[(value / sizeof(int)) % wait_queue_count];
+}
+
+/**
+ * Blocks as long as `*address` still holds `expected`, callers recheck their condition afterwards.
+ * The value is checked with the queue locked, so a wake_address() after the change cannot be missed.
+ */
+void wait_on_address(int* address, int expected) {
+    wait_queue_for(address).wait_if([address, expected] {
+        return __atomic_load_n(address, __ATOMIC_RELAXED) == expected;
+    });
+}
+
+/**
+ * Wakes all threads waiting on `address`. Different addresses can share a queue and waking only
+ * one thread might pick a waiter for another address, so every waiter wakes and rechecks its condition.
+ */
+void wake_address(int* address) {
+    wait_queue_for(address).wake_all();
+}
+
+NEVER_INLINE void lock_contended(pthread_mutex_t* mutex) {
+    for (int i = 0; i < mutex_spin_count; i++) {
+        int expected = mutex_unlocked;
+        if (__atomic_load_n(mutex, __ATOMIC_RELAXED) == mutex_unlocked &&
+            __atomic_compare_exchange_n(mutex, &expected, mutex_locked, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            return;
+        }
+
+        Kernel::Processor::spin_loop();
+    }
+
+    /* from here on the mutex is marked contended so that the owner knows it has to wake us */
+    while (__atomic_exchange_n(mutex, mutex_contended, __ATOMIC_ACQUIRE) != mutex_unlocked) {
+        wait_on_address(mutex, mutex_contended);
+    }
+}
+
+}
+
+int pthread_key_create(pthread_key_t* key, void (*destructor)(void*)) {
+    pthread_mutex_lock(&key_lock);
+
+    /* every key lookup goes through GS, so it has to point somewhere valid before the first key exists */
+    if (!thread_data_list) {
+        thread_data_list = &initial_thread_data;
+        Kernel::Processor::set_thread_pointer(reinterpret_cast<FlatPtr>(&initial_thread_data));
+    }
+
+    for (pthread_key_t i = 0; i < PTHREAD_KEYS_MAX; i++) {
+        if (key_slots[i].in_use) {
+            continue;
+        }
+
+        key_slots[i] = { true, destructor };
+
+        /* the key might have been deleted before, no thread may see its old value */
+        for (ThreadSpecificData* data = thread_data_list; data; data = data->next) {
+            data->values[i] = nullptr;
+        }
+
+        pthread_mutex_unlock(&key_lock);
+
+        *key = i;
+        return 0;
+    }
+
+    pthread_mutex_unlock(&key_lock);
+    return EAGAIN;
+}
+
+int pthread_key_delete(pthread_key_t key) {
+    if (key < 0 || key >= PTHREAD_KEYS_MAX) {
+        return EINVAL;
+    }
+
+    pthread_mutex_lock(&key_lock);
+
+    if (!key_slots[key].in_use) {
+        pthread_mutex_unlock(&key_lock);
+        return EINVAL;
+    }
+
+    key_slots[key] = { false, nullptr };
+
+    pthread_mutex_unlock(&key_lock);
     return 0;
 }
 
@@ -50,35 +183,101 @@ int pthread_once(pthread_once_t* control, void (*init)(void)) {
 }
 
 void* pthread_getspecific(pthread_key_t key) {
-    return thread_data_table[key];
+    return load_thread_value(key);
 }
 
 int pthread_setspecific(pthread_key_t key, const void* data) {
-    thread_data_table[key] = (void*)data;
+    store_thread_value(key, const_cast<void*>(data));
     return 0;
 }
 
+void __pthread_key_cleanup() {
+    /* destructors may set values again, POSIX allows giving up after a few rounds */
+    for (int round = 0; round < PTHREAD_DESTRUCTOR_ITERATIONS; round++) {
+        bool called_destructor = false;
+
+        for (pthread_key_t key = 0; key < PTHREAD_KEYS_MAX; key++) {
+            void* value = load_thread_value(key);
+            void (*destructor)(void*) = key_slots[key].destructor;
+
+            if (!value || !key_slots[key].in_use || !destructor) {
+                continue;
+            }
+
+            store_thread_value(key, nullptr);
+            destructor(value);
+            called_destructor = true;
+        }
+
+        if (!called_destructor) {
+            break;
+        }
+    }
+}
+
 int pthread_mutex_init(pthread_mutex_t* mutex, const pthread_mutexattr_t*) {
-    *mutex = 0;
+    *mutex = mutex_unlocked;
     return 0;
 }
 
 int pthread_mutex_lock(pthread_mutex_t* mutex) {
-    assert(*mutex == 0);
-    *mutex = 1;
+    int expected = mutex_unlocked;
+    if (__atomic_compare_exchange_n(mutex, &expected, mutex_locked, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        return 0;
+    }
+
+    lock_contended(mutex);
     return 0;
 }
 
+int pthread_mutex_trylock(pthread_mutex_t* mutex) {
+    int expected = mutex_unlocked;
+    if (__atomic_compare_exchange_n(mutex, &expected, mutex_locked, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        return 0;
+    }
+
+    return EBUSY;
+}
+
 int pthread_mutex_unlock(pthread_mutex_t* mutex) {
-    assert(*mutex != 0);
-    *mutex = 0;
+    int previous = __atomic_exchange_n(mutex, mutex_unlocked, __ATOMIC_RELEASE);
+    assert(previous != mutex_unlocked);
+
+    if (previous == mutex_contended) {
+        wake_address(mutex);
+    }
+
+    return 0;
+}
+
+int pthread_cond_init(pthread_cond_t* cond, const pthread_condattr_t*) {
+    *cond = 0;
     return 0;
 }
 
-int pthread_cond_wait(pthread_cond_t*, pthread_mutex_t*) {
+int pthread_cond_wait(pthread_cond_t* cond, pthread_mutex_t* mutex) {
+    /* a signal after this load changes the sequence, so the wait below cannot miss it */
+    int sequence = __atomic_load_n(cond, __ATOMIC_RELAXED);
+
+    pthread_mutex_unlock(mutex);
+    wait_on_address(cond, sequence);
+
+    /* other threads may be waiting on the mutex as well, so it has to be taken as contended */
+    while (__atomic_exchange_n(mutex, mutex_contended, __ATOMIC_ACQUIRE) != mutex_unlocked) {
+        wait_on_address(mutex, mutex_contended);
+    }
+
     return 0;
 }
 
-int pthread_cond_signal(pthread_cond_t*) {
+int pthread_cond_signal(pthread_cond_t* cond) {
+    __atomic_fetch_add(cond, 1, __ATOMIC_RELEASE);
+    wake_address(cond);
     return 0;
-}
\ No newline at end of file
+}
+
+int pthread_cond_broadcast(pthread_cond_t* cond) {
+    __atomic_fetch_add(cond, 1, __ATOMIC_RELEASE);
+    wake_address(cond);
+    return 0;
+}
@@ -35,14 +35,24 @@ __BEGIN_DECLS
 #define PTHREAD_MUTEX_INITIALIZER 0
 #define PTHREAD_ONCE_INIT         0
 
+#define PTHREAD_KEYS_MAX              64
+#define PTHREAD_DESTRUCTOR_ITERATIONS 4
+
 int pthread_key_create(pthread_key_t* key, void (*dtor)(void*));
+int pthread_key_delete(pthread_key_t key);
 int pthread_once(pthread_once_t* control, void (*init)(void));
 void* pthread_getspecific(pthread_key_t key);
 int pthread_setspecific(pthread_key_t key, const void* data);
 int pthread_mutex_init(pthread_mutex_t* mutex, const pthread_mutexattr_t* attr);
 int pthread_mutex_lock(pthread_mutex_t* mutex);
+int pthread_mutex_trylock(pthread_mutex_t* mutex);
 int pthread_mutex_unlock(pthread_mutex_t* mutex);
+int pthread_cond_init(pthread_cond_t* cond, const pthread_condattr_t* attr);
 int pthread_cond_wait(pthread_cond_t* cond, pthread_mutex_t* mutex);
 int pthread_cond_signal(pthread_cond_t* cond);
+int pthread_cond_broadcast(pthread_cond_t* cond);
+
+/* Runs the key destructors for the values of the calling thread, the kernel calls this when a thread exits. */
+void __pthread_key_cleanup(void);
 
 __END_DECLS
\ No newline at end of file
@@ -24,19 +24,450 @@
  */
 
 #include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+#include <Types.hpp>
+#include <Utility.hpp>
+#include <Platform.hpp>
+#include <StringView.hpp>
+#include <IntegerFormatting.hpp>
 
 #ifdef YEETOS_KERNEL
 
 #include <Kernel/Kernel.hpp>
+#include <Kernel/DebugLog.hpp>
+
+namespace {
+
+/**
+ * Collects the output of one printf() call and hands it to DebugLog in chunks,
+ * so the serial port is driven in bulk instead of once per character.
+ */
+class DebugLogSink {
+    NOT_COPYABLE(DebugLogSink);
+    NOT_MOVABLE(DebugLogSink);
+
+public:
+    DebugLogSink() = default;
+
+    ~DebugLogSink() {
+        flush();
+    }
+
+    ALWAYS_INLINE void put(char c) {
+        if (m_used == sizeof(m_buffer))
+            flush();
+        m_buffer[m_used++] = c;
+        m_total++;
+    }
+
+    void write(const char* str, usize length) {
+        m_total += length;
+        while (length) {
+            if (m_used == sizeof(m_buffer))
+                flush();
+
+            usize chunk = yt::min(length, sizeof(m_buffer) - m_used);
+            memcpy(m_buffer + m_used, str, chunk);
+            m_used += chunk, str += chunk, length -= chunk;
+        }
+    }
+
+    void fill(char c, usize count) {
+        while (count--) {
+            put(c);
+        }
+    }
+
+    void flush() {
+        if (m_used) {
+            Kernel::DebugLog::print(yt::StringView(m_buffer, m_used));
+            m_used = 0;
+        }
+    }
+
+    usize total() const {
+        return m_total;
+    }
+
+private:
+    char m_buffer[256];
+    usize m_used = 0;
+    usize m_total = 0;
+};
+
+/**
+ * Writes into a caller provided buffer for snprintf(). Output past the end is counted but dropped.
+ */
+class BufferSink {
+    NOT_COPYABLE(BufferSink);
+    NOT_MOVABLE(BufferSink);
+
+public:
+    BufferSink(char* buffer, usize size) : m_buffer(buffer), m_size(size) {
+    }
+
+    ALWAYS_INLINE void put(char c) {
+        if (m_total + 1 < m_size)
+            m_buffer[m_total] = c;
+        m_total++;
+    }
+
+    void write(const char* str, usize length) {
+        if (m_total + 1 < m_size)
+            memcpy(m_buffer + m_total, str, yt::min(length, m_size - 1 - m_total));
+        m_total += length;
+    }
+
+    void fill(char c, usize count) {
+        if (m_total + 1 < m_size)
+            memset(m_buffer + m_total, c, yt::min(count, m_size - 1 - m_total));
+        m_total += count;
+    }
+
+    void terminate() {
+        if (m_size)
+            m_buffer[yt::min(m_total, m_size - 1)] = '\0';
+    }
+
+    usize total() const {
+        return m_total;
+    }
+
+private:
+    char* m_buffer;
+    usize m_size;
+    usize m_total = 0;
+};
+
+enum class Length {
+    Default,
+    Char,
+    Short,
+    Long,
+    LongLong,
+    Size,
+    Max,
+    PtrDiff,
+};
+
+struct Spec {
+    bool left_align = false;
+    bool plus_sign = false;
+    bool space_sign = false;
+    bool alternate = false;
+    bool zero_pad = false;
+    int width = 0;
+    int precision = -1;
+    Length length = Length::Default;
+};
+
+template<typename Sink>
+void pad(Sink& sink, const Spec& spec, usize length) {
+    if (static_cast<usize>(spec.width) > length)
+        sink.fill(' ', spec.width - length);
+}
+
+template<typename Sink>
+void emit_string(Sink& sink, const Spec& spec, const char* str) {
+    if (!str)
+        str = "(null)";
+
+    usize length = spec.precision >= 0 ? strnlen(str, spec.precision) : strlen(str);
+
+    if (!spec.left_align)
+        pad(sink, spec, length);
+    sink.write(str, length);
+    if (spec.left_align)
+        pad(sink, spec, length);
+}
+
+template<typename Sink>
+void emit_integer(Sink& sink, const Spec& spec, u64 magnitude, bool negative, u32 base, bool uppercase) {
+    char buffer[yt::max_integer_digits];
+    char* end = buffer + sizeof(buffer);
+    char* digits = end;
+
+    /* an explicit precision of zero prints nothing for zero */
+    if (magnitude || spec.precision != 0)
+        digits = yt::format_unsigned(end, magnitude, base, uppercase);
+
+    usize digit_count = end - digits;
+
+    char prefix[2];
+    usize prefix_length = 0;
+
+    if (negative) {
+        prefix[prefix_length++] = '-';
+    } else if (spec.plus_sign) {
+        prefix[prefix_length++] = '+';
+    } else if (spec.space_sign) {
+        prefix[prefix_length++] = ' ';
+    }
+
+    if (spec.alternate) {
+        if (base == 16 && magnitude) {
+            prefix[prefix_length++] = '0';
+            prefix[prefix_length++] = uppercase ? 'X' : 'x';
+        } else if (base == 8 && (digit_count == 0 || *digits != '0')) {
+            prefix[prefix_length++] = '0';
+        }
+    }
+
+    usize zeros = 0;
+    if (spec.precision >= 0 && static_cast<usize>(spec.precision) > digit_count)
+        zeros = spec.precision - digit_count;
+
+    usize length = prefix_length + zeros + digit_count;
+
+    if (spec.zero_pad && !spec.left_align && spec.precision < 0 && static_cast<usize>(spec.width) > length) {
+        zeros += spec.width - length;
+        length = spec.width;
+    }
+
+    if (!spec.left_align)
+        pad(sink, spec, length);
+
+    sink.write(prefix, prefix_length);
+    sink.fill('0', zeros);
+    sink.write(digits, digit_count);
+
+    if (spec.left_align)
+        pad(sink, spec, length);
+}
+
+i64 signed_argument(Length length, va_list& args) {
+    switch (length) {
+    case Length::Char:
+        return static_cast<signed char>(va_arg(args, int));
+    case Length::Short:
+        return static_cast<short>(va_arg(args, int));
+    case Length::Long:
+        return va_arg(args, long);
+    case Length::LongLong:
+        return va_arg(args, long long);
+    case Length::Size:
+        return va_arg(args, isize);
+    case Length::Max:
+        return va_arg(args, i64);
+    case Length::PtrDiff:
+        return va_arg(args, __PTRDIFF_TYPE__);
+    default:
+        return va_arg(args, int);
+    }
+}
+
+u64 unsigned_argument(Length length, va_list& args) {
+    switch (length) {
+    case Length::Char:
+        return static_cast<unsigned char>(va_arg(args, unsigned int));
+    case Length::Short:
+        return static_cast<unsigned short>(va_arg(args, unsigned int));
+    case Length::Long:
+        return va_arg(args, unsigned long);
+    case Length::LongLong:
+        return va_arg(args, unsigned long long);
+    case Length::Size:
+        return va_arg(args, usize);
+    case Length::Max:
+        return va_arg(args, u64);
+    case Length::PtrDiff:
+        return static_cast<u64>(va_arg(args, __PTRDIFF_TYPE__));
+    default:
+        return va_arg(args, unsigned int);
+    }
+}
+
+/**
+ * The printf() engine. Supports the flags `-+ #0`, width and precision (also as `*`),
+ * the length modifiers hh, h, l, ll, z, j, t and the conversions d, i, u, o, x, X, c, s, p and %.
+ * There is no floating point support as the kernel is built without an FPU.
+ */
+template<typename Sink>
+void format_arguments(Sink& sink, const char* fmt, va_list& args) {
+    while (*fmt) {
+        /* copy literal text up to the next conversion in one go */
+        const char* percent = strchr(fmt, '%');
+        if (!percent) {
+            sink.write(fmt, strlen(fmt));
+            return;
+        }
+
+        sink.write(fmt, percent - fmt);
+        fmt = percent + 1;
+
+        Spec spec;
+
+        for (;; fmt++) {
+            if (*fmt == '-') {
+                spec.left_align = true;
+            } else if (*fmt == '+') {
+                spec.plus_sign = true;
+            } else if (*fmt == ' ') {
+                spec.space_sign = true;
+            } else if (*fmt == '#') {
+                spec.alternate = true;
+            } else if (*fmt == '0') {
+                spec.zero_pad = true;
+            } else {
+                break;
+            }
+        }
+
+        if (*fmt == '*') {
+            spec.width = va_arg(args, int);
+            if (spec.width < 0) {
+                spec.left_align = true;
+                spec.width = -spec.width;
+            }
+            fmt++;
+        } else {
+            for (; *fmt >= '0' && *fmt <= '9'; fmt++) {
+                spec.width = spec.width * 10 + (*fmt - '0');
+            }
+        }
+
+        if (*fmt == '.') {
+            fmt++;
+            spec.precision = 0;
+            if (*fmt == '*') {
+                spec.precision = va_arg(args, int);
+                fmt++;
+            } else {
+                for (; *fmt >= '0' && *fmt <= '9'; fmt++) {
+                    spec.precision = spec.precision * 10 + (*fmt - '0');
+                }
+            }
+        }
+
+        switch (*fmt) {
+        case 'h':
+            spec.length = fmt[1] == 'h' ? Length::Char : Length::Short;
+            fmt += fmt[1] == 'h' ? 2 : 1;
+            break;
+        case 'l':
+            spec.length = fmt[1] == 'l' ? Length::LongLong : Length::Long;
+            fmt += fmt[1] == 'l' ? 2 : 1;
+            break;
+        case 'z':
+            spec.length = Length::Size;
+            fmt++;
+            break;
+        case 'j':
+            spec.length = Length::Max;
+            fmt++;
+            break;
+        case 't':
+            spec.length = Length::PtrDiff;
+            fmt++;
+            break;
+        }
+
+        switch (*fmt) {
+        case 'd':
+        case 'i': {
+            i64 value = signed_argument(spec.length, args);
+            u64 magnitude = value < 0 ? -static_cast<u64>(value) : static_cast<u64>(value);
+            emit_integer(sink, spec, magnitude, value < 0, 10, false);
+            break;
+        }
+        case 'u':
+            emit_integer(sink, spec, unsigned_argument(spec.length, args), false, 10, false);
+            break;
+        case 'o':
+            emit_integer(sink, spec, unsigned_argument(spec.length, args), false, 8, false);
+            break;
+        case 'x':
+        case 'X':
+            emit_integer(sink, spec, unsigned_argument(spec.length, args), false, 16, *fmt == 'X');
+            break;
+        case 'p':
+            spec.alternate = true;
+            emit_integer(sink, spec, reinterpret_cast<FlatPtr>(va_arg(args, void*)), false, 16, false);
+            break;
+        case 'c': {
+            char c = static_cast<char>(va_arg(args, int));
+            if (!spec.left_align)
+                pad(sink, spec, 1);
+            sink.put(c);
+            if (spec.left_align)
+                pad(sink, spec, 1);
+            break;
+        }
+        case 's':
+            emit_string(sink, spec, va_arg(args, const char*));
+            break;
+        case '%':
+            sink.put('%');
+            break;
+        case '\0':
+            /* a lone '%' at the end of the format string */
+            return;
+        default:
+            /* unknown conversion, print it as is */
+            sink.write(percent, fmt + 1 - percent);
+            break;
+        }
+
+        fmt++;
+    }
+}
+
+template<typename Sink>
+void format(Sink& sink, const char* fmt, va_list original_args) {
+    /* work on a local copy, a va_list parameter cannot be passed on by reference where va_list is an array */
+    va_list args;
+    va_copy(args, original_args);
+    format_arguments(sink, fmt, args);
+    va_end(args);
+}
+
+} /* namespace */
+
+extern "C" int vsnprintf(char* __restrict buffer, size_t count, const char* __restrict fmt, va_list args) {
+    BufferSink sink(buffer, count);
+    format(sink, fmt, args);
+    sink.terminate();
+    return static_cast<int>(sink.total());
+}
+
+extern "C" int snprintf(char* __restrict buffer, size_t count, const char* __restrict fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int res = vsnprintf(buffer, count, fmt, args);
+    va_end(args);
+    return res;
+}
+
+extern "C" int vfprintf(FILE* __restrict stream, const char* __restrict fmt, va_list args) {
+    /* stdout and stderr both end up on the debug log */
+    if (stream != stdout && stream != stderr)
+        return -1;
+
+    DebugLogSink sink;
+    format(sink, fmt, args);
+    return static_cast<int>(sink.total());
+}
+
+extern "C" int fprintf(FILE* __restrict stream, const char* __restrict fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int res = vfprintf(stream, fmt, args);
+    va_end(args);
+    return res;
+}
 
-int printf(const char* __restrict fmt, ...) {
-    // TODO: implement printf
-    return 0;
+extern "C" int vprintf(const char* __restrict fmt, va_list args) {
+    return vfprintf(stdout, fmt, args);
 }
 
-int fprintf(FILE* __restrict stream, const char* __restrict fmt, ...) {
-    // TODO: implement fprintf
-    return 0;
+extern "C" int printf(const char* __restrict fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int res = vprintf(fmt, args);
+    va_end(args);
+    return res;
 }
 
 #else /* YEETOS_KERNEL */
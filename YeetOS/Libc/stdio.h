@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <stdarg.h>
 #include <stddef.h>
 #include <sys/cdefs.h>
 
@@ -38,8 +39,14 @@ typedef struct FILE {
 #define stdint ((FILE*)2)
 #define stderr ((FILE*)3)
 
-int printf(const char* __restrict fmt, ...);
-int fprintf(FILE* __restrict stream, const char* __restrict fmt, ...);
-int snprintf(char* __restrict buffer, size_t count, const char* __restrict fmt, ...);
+#define __PRINTF_FORMAT(fmt_index, first_arg) __attribute__((__format__(__printf__, fmt_index, first_arg)))
+
+int printf(const char* __restrict fmt, ...) __PRINTF_FORMAT(1, 2);
+int fprintf(FILE* __restrict stream, const char* __restrict fmt, ...) __PRINTF_FORMAT(2, 3);
+int snprintf(char* __restrict buffer, size_t count, const char* __restrict fmt, ...) __PRINTF_FORMAT(3, 4);
+
+int vprintf(const char* __restrict fmt, va_list args) __PRINTF_FORMAT(1, 0);
+int vfprintf(FILE* __restrict stream, const char* __restrict fmt, va_list args) __PRINTF_FORMAT(2, 0);
+int vsnprintf(char* __restrict buffer, size_t count, const char* __restrict fmt, va_list args) __PRINTF_FORMAT(3, 0);
 
 __END_DECLS
\ No newline at end of file
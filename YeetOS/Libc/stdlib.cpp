@@ -23,10 +23,15 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <errno.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <Types.hpp>
+#include <Utility.hpp>
+#include <Concepts.hpp>
+#include <TypeMagic.hpp>
+#include <NumericLimits.hpp>
 
 #ifdef YEETOS_KERNEL
 
@@ -62,6 +67,348 @@ extern "C" void abort() {
     while (1) {}
 }
 
+namespace {
+
+using Compar = int (*)(const void*, const void*);
+
+ALWAYS_INLINE bool is_space(char c) {
+    return c == ' ' || static_cast<unsigned char>(c - '\t') < 5;
+}
+
+/* Value of `c` as a digit in any base up to 36, or a value >= 36 if it is none. */
+ALWAYS_INLINE u32 digit_value(char c) {
+    u32 digit = static_cast<u8>(c - '0');
+    if (digit < 10) {
+        return digit;
+    }
+
+    u32 letter = static_cast<u8>((c | 0x20) - 'a');
+    return letter < 26 ? letter + 10 : 36;
+}
+
+/**
+ * Accumulates the digits at `str` into `value` until a character that is not a digit in `base` is found.
+ * Instead of failing on a value larger than `limit` the remaining digits are consumed and `overflow` is set.
+ * This is inlined into parse_integer() twice so that the common base 10 loop multiplies by a constant.
+ */
+template<UnsignedIntegral U>
+ALWAYS_INLINE const char* accumulate_digits(const char* str, u32 base, U limit, U& value, bool& overflow) {
+    const U cutoff = limit / base;
+    const u32 cutlim = limit % base;
+
+    for (;; str++) {
+        u32 digit = digit_value(*str);
+        if (digit >= base) {
+            return str;
+        }
+
+        if (value > cutoff || (value == cutoff && digit > cutlim)) {
+            overflow = true;
+        } else {
+            value = value * base + digit;
+        }
+    }
+}
+
+template<Integral T>
+T parse_integer(const char* str, char** endptr, int base) {
+    using U = yt::make_unsigned<T>;
+
+    const char* ptr = str;
+
+    while (is_space(*ptr)) {
+        ptr++;
+    }
+
+    bool negative = false;
+    if (*ptr == '-') {
+        negative = true;
+        ptr++;
+    } else if (*ptr == '+') {
+        ptr++;
+    }
+
+    if ((base == 0 || base == 16) && ptr[0] == '0' && (ptr[1] | 0x20) == 'x' && digit_value(ptr[2]) < 16) {
+        ptr += 2;
+        base = 16;
+    } else if (base == 0) {
+        base = ptr[0] == '0' ? 8 : 10;
+    }
+
+    if (base < 2 || base > 36) {
+        if (endptr) {
+            *endptr = const_cast<char*>(str);
+        }
+
+        errno = EINVAL;
+        return 0;
+    }
+
+    U limit = NumericLimits<U>::max();
+    if constexpr (NumericLimits<T>::is_signed()) {
+        limit = static_cast<U>(NumericLimits<T>::max()) + negative;
+    }
+
+    U value = 0;
+    bool overflow = false;
+    const char* digits = ptr;
+
+    if (base == 10) {
+        ptr = accumulate_digits<U>(ptr, 10, limit, value, overflow);
+    } else {
+        ptr = accumulate_digits<U>(ptr, base, limit, value, overflow);
+    }
+
+    if (endptr) {
+        *endptr = const_cast<char*>(ptr == digits ? str : ptr);
+    }
+
+    if (overflow) {
+        errno = ERANGE;
+
+        if constexpr (NumericLimits<T>::is_signed()) {
+            return negative ? NumericLimits<T>::min() : NumericLimits<T>::max();
+        } else {
+            return NumericLimits<T>::max();
+        }
+    }
+
+    return static_cast<T>(negative ? U(0) - value : value);
+}
+
+/* Ranges with at most this many elements are sorted by insertion sort in sort_elements(). */
+constexpr usize insertion_sort_threshold = 12;
+
+void swap_bytes(u8* a, u8* b, usize size) {
+    while (size >= sizeof(FlatPtr)) {
+        FlatPtr temp;
+        __builtin_memcpy(&temp, a, sizeof(FlatPtr));
+        __builtin_memcpy(a, b, sizeof(FlatPtr));
+        __builtin_memcpy(b, &temp, sizeof(FlatPtr));
+
+        a += sizeof(FlatPtr);
+        b += sizeof(FlatPtr);
+        size -= sizeof(FlatPtr);
+    }
+
+    while (size--) {
+        swap(*a++, *b++);
+    }
+}
+
+/**
+ * The sort below is instantiated for common element sizes with `FixedSize` set, so that swaps
+ * become a few fixed-size moves. A `FixedSize` of 0 handles any size with swap_bytes().
+ */
+template<usize FixedSize>
+ALWAYS_INLINE void swap_elements(u8* a, u8* b, usize size) {
+    if constexpr (FixedSize != 0) {
+        u8 temp[FixedSize];
+        __builtin_memcpy(temp, a, FixedSize);
+        __builtin_memcpy(a, b, FixedSize);
+        __builtin_memcpy(b, temp, FixedSize);
+    } else {
+        swap_bytes(a, b, size);
+    }
+}
+
+template<usize FixedSize>
+void insertion_sort(u8* base, usize count, usize size, Compar compar) {
+    size = FixedSize != 0 ? FixedSize : size;
+
+    u8* end = base + count * size;
+
+    for (u8* cur = base + size; cur < end; cur += size) {
+        for (u8* sift = cur; sift > base && compar(sift - size, sift) > 0; sift -= size) {
+            swap_elements<FixedSize>(sift - size, sift, size);
+        }
+    }
+}
+
+template<usize FixedSize>
+void sift_down(u8* base, usize count, usize index, usize size, Compar compar) {
+    size = FixedSize != 0 ? FixedSize : size;
+
+    while (true) {
+        usize child = 2 * index + 1;
+        if (child >= count) {
+            break;
+        }
+
+        if (child + 1 < count && compar(base + child * size, base + (child + 1) * size) < 0) {
+            child++;
+        }
+
+        if (compar(base + index * size, base + child * size) >= 0) {
+            break;
+        }
+
+        swap_elements<FixedSize>(base + index * size, base + child * size, size);
+        index = child;
+    }
+}
+
+template<usize FixedSize>
+void heap_sort(u8* base, usize count, usize size, Compar compar) {
+    size = FixedSize != 0 ? FixedSize : size;
+
+    for (usize i = count / 2; i > 0; i--) {
+        sift_down<FixedSize>(base, count, i - 1, size, compar);
+    }
+
+    for (usize end = count - 1; end > 0; end--) {
+        swap_elements<FixedSize>(base, base + end * size, size);
+        sift_down<FixedSize>(base, end, 0, size, compar);
+    }
+}
+
+/**
+ * Introsort: median of three quicksort that recurses into the smaller partition, switching to
+ * heapsort once `depth` bad partitions were made. The pivot stays inside the array, so `compar`
+ * only ever sees pointers to elements of the array, as C requires.
+ */
+template<usize FixedSize>
+void sort_elements(u8* base, usize count, usize size, Compar compar, usize depth) {
+    size = FixedSize != 0 ? FixedSize : size;
+
+    while (count > insertion_sort_threshold) {
+        if (depth == 0) {
+            heap_sort<FixedSize>(base, count, size, compar);
+            return;
+        }
+
+        depth--;
+
+        u8* mid = base + (count / 2) * size;
+        u8* last = base + (count - 1) * size;
+
+        if (compar(mid, base) < 0) {
+            swap_elements<FixedSize>(mid, base, size);
+        }
+
+        if (compar(last, mid) < 0) {
+            swap_elements<FixedSize>(last, mid, size);
+
+            if (compar(mid, base) < 0) {
+                swap_elements<FixedSize>(mid, base, size);
+            }
+        }
+
+        /* the median becomes the pivot at `base`, `last` stops the upward scan */
+        swap_elements<FixedSize>(base, mid, size);
+
+        u8* lo = base;
+        u8* hi = last + size;
+
+        while (true) {
+            do {
+                lo += size;
+            } while (compar(lo, base) < 0);
+
+            do {
+                hi -= size;
+            } while (compar(hi, base) > 0);
+
+            if (lo >= hi) {
+                break;
+            }
+
+            swap_elements<FixedSize>(lo, hi, size);
+        }
+
+        swap_elements<FixedSize>(base, hi, size);
+
+        usize left = (hi - base) / size;
+        usize right = count - left - 1;
+
+        if (left < right) {
+            sort_elements<FixedSize>(base, left, size, compar, depth);
+            base = hi + size;
+            count = right;
+        } else {
+            sort_elements<FixedSize>(hi + size, right, size, compar, depth);
+            count = left;
+        }
+    }
+
+    insertion_sort<FixedSize>(base, count, size, compar);
+}
+
+} /* namespace */
+
+extern "C" long strtol(const char* str, char** endptr, int base) {
+    return parse_integer<long>(str, endptr, base);
+}
+
+extern "C" long long strtoll(const char* str, char** endptr, int base) {
+    return parse_integer<long long>(str, endptr, base);
+}
+
+extern "C" unsigned long strtoul(const char* str, char** endptr, int base) {
+    return parse_integer<unsigned long>(str, endptr, base);
+}
+
+extern "C" unsigned long long strtoull(const char* str, char** endptr, int base) {
+    return parse_integer<unsigned long long>(str, endptr, base);
+}
+
+extern "C" int atoi(const char* str) {
+    return static_cast<int>(parse_integer<long>(str, nullptr, 10));
+}
+
+extern "C" long atol(const char* str) {
+    return parse_integer<long>(str, nullptr, 10);
+}
+
+extern "C" long long atoll(const char* str) {
+    return parse_integer<long long>(str, nullptr, 10);
+}
+
+extern "C" void qsort(void* base, size_t count, size_t size, Compar compar) {
+    if (count < 2 || size == 0) {
+        return;
+    }
+
+    usize depth = 0;
+    for (usize n = count; n > 1; n >>= 1) {
+        depth += 2;
+    }
+
+    u8* bytes = static_cast<u8*>(base);
+
+    switch (size) {
+    case 1: return sort_elements<1>(bytes, count, size, compar, depth);
+    case 2: return sort_elements<2>(bytes, count, size, compar, depth);
+    case 4: return sort_elements<4>(bytes, count, size, compar, depth);
+    case 8: return sort_elements<8>(bytes, count, size, compar, depth);
+    case 16: return sort_elements<16>(bytes, count, size, compar, depth);
+    default: return sort_elements<0>(bytes, count, size, compar, depth);
+    }
+}
+
+extern "C" void* bsearch(const void* key, const void* base, size_t count, size_t size, Compar compar) {
+    const u8* lo = static_cast<const u8*>(base);
+
+    while (count > 0) {
+        usize half = count / 2;
+        const u8* mid = lo + half * size;
+
+        int result = compar(key, mid);
+        if (result == 0) {
+            return const_cast<u8*>(mid);
+        }
+
+        if (result > 0) {
+            lo = mid + size;
+            count -= half + 1;
+        } else {
+            count = half;
+        }
+    }
+
+    return nullptr;
+}
+
 #else /* YEETOS_KERNEL */
 #error "stdlib not implemented"
 #endif /* YEETOS_KERNEL */
@@ -35,6 +35,16 @@ void* malloc(size_t size);
 void free(void* ptr);
 void* calloc(size_t size, size_t num);
 void* realloc(void* ptr, size_t size);
+
 long strtol(const char* __restrict str, char** __restrict endptr, int base);
+long long strtoll(const char* __restrict str, char** __restrict endptr, int base);
+unsigned long strtoul(const char* __restrict str, char** __restrict endptr, int base);
+unsigned long long strtoull(const char* __restrict str, char** __restrict endptr, int base);
+int atoi(const char* str);
+long atol(const char* str);
+long long atoll(const char* str);
+
+void qsort(void* base, size_t count, size_t size, int (*compar)(const void*, const void*));
+void* bsearch(const void* key, const void* base, size_t count, size_t size, int (*compar)(const void*, const void*));
 
 __END_DECLS
\ No newline at end of file
@@ -25,14 +25,230 @@
 
 #include <string.h>
 
-extern "C" void* memcpy(void* dest, const void* src, size_t num) {
-    unsigned char* d = static_cast<unsigned char*>(dest);
-    const unsigned char* s = static_cast<const unsigned char*>(src);
+#include <Types.hpp>
+#include <Platform.hpp>
+
+#if defined(YEETOS_KERNEL) && IS_ARCH(x86)
+    #include <Kernel/Arch/x86/Asm.hpp>
+    #include <Kernel/Arch/Processor.hpp>
+    #define HAVE_REP_STRING 1
+#endif
+
+namespace {
+
+using Word = FlatPtr;
+
+/* may_alias so word accesses do not break strict aliasing, aligned(1) so a misaligned source is fine */
+using AliasedWord = Word __attribute__((__may_alias__));
+using UnalignedWord = Word __attribute__((__may_alias__, __aligned__(1)));
+
+constexpr size_t word_size = sizeof(Word);
+
+constexpr Word low_bits = static_cast<Word>(-1) / 0xFF;
+constexpr Word high_bits = low_bits * 0x80;
+
+/* below this size the setup cost of aligning and of rep string instructions does not pay off */
+constexpr size_t small_copy_size = 2 * word_size;
+
+/* from this size on rep movs/stos beat a plain word loop, even without ERMS */
+constexpr size_t rep_string_size = 512;
+
+/**
+ * True if any byte of `word` is zero. Only the answer as a whole is exact,
+ * bytes above the first zero byte may be flagged as well.
+ */
+ALWAYS_INLINE constexpr bool has_zero_byte(Word word) {
+    return ((word - low_bits) & ~word & high_bits) != 0;
+}
+
+ALWAYS_INLINE constexpr Word repeat_byte(unsigned char val) {
+    return low_bits * val;
+}
+
+ALWAYS_INLINE bool is_word_aligned(const void* ptr) {
+    return (reinterpret_cast<FlatPtr>(ptr) & (word_size - 1)) == 0;
+}
 
+ALWAYS_INLINE Word load_word(const void* ptr) {
+    return *static_cast<const AliasedWord*>(ptr);
+}
+
+ALWAYS_INLINE void copy_bytes(unsigned char* d, const unsigned char* s, size_t num) {
     while (num--) {
         *d = *s;
         d++, s++;
     }
+}
+
+/* `d` and `s` point one past the end */
+ALWAYS_INLINE void copy_bytes_backward(unsigned char* d, const unsigned char* s, size_t num) {
+    while (num--) {
+        d--, s--;
+        *d = *s;
+    }
+}
+
+ALWAYS_INLINE void set_bytes(unsigned char* d, unsigned char val, size_t num) {
+    while (num--) {
+        *d = val;
+        d++;
+    }
+}
+
+/**
+ * Copies bytes until `d` is word aligned and returns how many were copied.
+ * Requires `num >= word_size`.
+ */
+ALWAYS_INLINE size_t copy_head(unsigned char* d, const unsigned char* s) {
+    size_t head = -reinterpret_cast<FlatPtr>(d) & (word_size - 1);
+    copy_bytes(d, s, head);
+    return head;
+}
+
+ALWAYS_INLINE void copy_words(unsigned char* d, const unsigned char* s, size_t num) {
+    size_t head = copy_head(d, s);
+    d += head, s += head, num -= head;
+
+    AliasedWord* dw = reinterpret_cast<AliasedWord*>(d);
+    const UnalignedWord* sw = reinterpret_cast<const UnalignedWord*>(s);
+
+    for (size_t count = num / word_size; count--;) {
+        *dw = *sw;
+        dw++, sw++;
+    }
+
+    copy_bytes(reinterpret_cast<unsigned char*>(dw), reinterpret_cast<const unsigned char*>(sw), num % word_size);
+}
+
+/**
+ * Same as copy_words() but from the end to the start, so it is correct if `d` overlaps the end of `s`.
+ * Requires `num >= word_size`.
+ */
+ALWAYS_INLINE void copy_words_backward(unsigned char* d, const unsigned char* s, size_t num) {
+    d += num, s += num;
+
+    size_t tail = reinterpret_cast<FlatPtr>(d) & (word_size - 1);
+    copy_bytes_backward(d, s, tail);
+    d -= tail, s -= tail, num -= tail;
+
+    AliasedWord* dw = reinterpret_cast<AliasedWord*>(d);
+    const UnalignedWord* sw = reinterpret_cast<const UnalignedWord*>(s);
+
+    for (size_t count = num / word_size; count--;) {
+        dw--, sw--;
+        *dw = *sw;
+    }
+
+    copy_bytes_backward(reinterpret_cast<unsigned char*>(dw), reinterpret_cast<const unsigned char*>(sw), num % word_size);
+}
+
+ALWAYS_INLINE void set_words(unsigned char* d, unsigned char val, size_t num) {
+    size_t head = -reinterpret_cast<FlatPtr>(d) & (word_size - 1);
+    set_bytes(d, val, head);
+    d += head, num -= head;
+
+    Word pattern = repeat_byte(val);
+    AliasedWord* dw = reinterpret_cast<AliasedWord*>(d);
+
+    for (size_t count = num / word_size; count--;) {
+        *dw = pattern;
+        dw++;
+    }
+
+    set_bytes(reinterpret_cast<unsigned char*>(dw), val, num % word_size);
+}
+
+#ifdef HAVE_REP_STRING
+
+ALWAYS_INLINE void copy_rep_movsd(unsigned char* d, const unsigned char* s, size_t num) {
+    size_t head = copy_head(d, s);
+    d += head, s += head, num -= head;
+
+    movsd(d, s, num / 4);
+    d += num & ~size_t(3), s += num & ~size_t(3);
+
+    copy_bytes(d, s, num & 3);
+}
+
+ALWAYS_INLINE void copy_rep_movsd_backward(unsigned char* d, const unsigned char* s, size_t num) {
+    d += num, s += num;
+
+    size_t tail = reinterpret_cast<FlatPtr>(d) & 3;
+    copy_bytes_backward(d, s, tail);
+    d -= tail, s -= tail, num -= tail;
+
+    movsd_backward(d - 4, s - 4, num / 4);
+    d -= num & ~size_t(3), s -= num & ~size_t(3);
+
+    copy_bytes_backward(d, s, num & 3);
+}
+
+ALWAYS_INLINE void set_rep_stosd(unsigned char* d, unsigned char val, size_t num) {
+    size_t head = -reinterpret_cast<FlatPtr>(d) & 3;
+    set_bytes(d, val, head);
+    d += head, num -= head;
+
+    stosd(d, 0x01010101u * val, num / 4);
+    d += num & ~size_t(3);
+
+    set_bytes(d, val, num & 3);
+}
+
+#endif /* HAVE_REP_STRING */
+
+/**
+ * Copies from low to high addresses, which is also correct for overlapping buffers when `d < s`.
+ */
+ALWAYS_INLINE void copy_forward(unsigned char* d, const unsigned char* s, size_t num) {
+#ifdef HAVE_REP_STRING
+    /* FSRM makes rep movsb the best choice at every size, ERMS only once the startup cost is amortized */
+    if (Kernel::Processor::has_fsrm() || (num >= rep_string_size && Kernel::Processor::has_erms())) {
+        movsb(d, s, num);
+        return;
+    }
+
+    if (num >= rep_string_size) {
+        copy_rep_movsd(d, s, num);
+        return;
+    }
+#endif
+
+    if (num < small_copy_size) {
+        copy_bytes(d, s, num);
+    } else {
+        copy_words(d, s, num);
+    }
+}
+
+} /* namespace */
+
+extern "C" void* memcpy(void* dest, const void* src, size_t num) {
+    copy_forward(static_cast<unsigned char*>(dest), static_cast<const unsigned char*>(src), num);
+    return dest;
+}
+
+extern "C" void* memmove(void* dest, const void* src, size_t num) {
+    unsigned char* d = static_cast<unsigned char*>(dest);
+    const unsigned char* s = static_cast<const unsigned char*>(src);
+
+    if (d <= s || d >= s + num) {
+        copy_forward(d, s, num);
+        return dest;
+    }
+
+    /* `d` overlaps the end of `s`, copy backwards. ERMS does not speed up backward rep movsb, so use movsd. */
+#ifdef HAVE_REP_STRING
+    if (num >= rep_string_size) {
+        copy_rep_movsd_backward(d, s, num);
+        return dest;
+    }
+#endif
+
+    if (num < small_copy_size) {
+        copy_bytes_backward(d + num, s + num, num);
+    } else {
+        copy_words_backward(d, s, num);
+    }
 
     return dest;
 }
@@ -41,14 +257,90 @@ extern "C" void* memset(void* dest, int c, size_t num) {
     unsigned char* d = static_cast<unsigned char*>(dest);
     unsigned char val = static_cast<unsigned char>(c);
 
-    while (num--) {
-        *d = val;
-        d++;
+#ifdef HAVE_REP_STRING
+    if (num >= rep_string_size) {
+        if (Kernel::Processor::has_erms()) {
+            stosb(d, val, num);
+        } else {
+            set_rep_stosd(d, val, num);
+        }
+        return dest;
+    }
+#endif
+
+    if (num < small_copy_size) {
+        set_bytes(d, val, num);
+    } else {
+        set_words(d, val, num);
     }
 
     return dest;
 }
 
+extern "C" int memcmp(const void* lhs, const void* rhs, size_t num) {
+    const unsigned char* l = static_cast<const unsigned char*>(lhs);
+    const unsigned char* r = static_cast<const unsigned char*>(rhs);
+
+    /* skip over equal words, the first differing one is resolved bytewise below */
+    for (; num >= word_size; l += word_size, r += word_size, num -= word_size) {
+        if (*reinterpret_cast<const UnalignedWord*>(l) != *reinterpret_cast<const UnalignedWord*>(r))
+            break;
+    }
+
+    for (; num--; l++, r++) {
+        if (*l != *r)
+            return *l - *r;
+    }
+
+    return 0;
+}
+
+extern "C" void* memchr(const void* ptr, int c, size_t num) {
+    const unsigned char* p = static_cast<const unsigned char*>(ptr);
+    unsigned char val = static_cast<unsigned char>(c);
+
+    for (; num && !is_word_aligned(p); p++, num--) {
+        if (*p == val)
+            return const_cast<unsigned char*>(p);
+    }
+
+    Word pattern = repeat_byte(val);
+    for (; num >= word_size; p += word_size, num -= word_size) {
+        if (has_zero_byte(load_word(p) ^ pattern))
+            break;
+    }
+
+    for (; num--; p++) {
+        if (*p == val)
+            return const_cast<unsigned char*>(p);
+    }
+
+    return nullptr;
+}
+
+extern "C" void* memrchr(const void* ptr, int c, size_t num) {
+    const unsigned char* p = static_cast<const unsigned char*>(ptr) + num;
+    unsigned char val = static_cast<unsigned char>(c);
+
+    for (; num && !is_word_aligned(p); num--) {
+        if (*--p == val)
+            return const_cast<unsigned char*>(p);
+    }
+
+    Word pattern = repeat_byte(val);
+    for (; num >= word_size; p -= word_size, num -= word_size) {
+        if (has_zero_byte(load_word(p - word_size) ^ pattern))
+            break;
+    }
+
+    while (num--) {
+        if (*--p == val)
+            return const_cast<unsigned char*>(p);
+    }
+
+    return nullptr;
+}
+
 extern "C" int strcmp(const char* str1, const char* str2) {
     for (;; str1++, str2++) {
         if (*str1 != *str2)
@@ -61,12 +353,49 @@ extern "C" int strcmp(const char* str1, const char* str2) {
     return *str1 - *str2;
 }
 
+/*
+ * The string scans below read whole aligned words, which may go past the terminator
+ * but never across a page boundary, so they cannot fault.
+ */
+
 extern "C" size_t strlen(const char* str) {
-    const char* start = str;
-    while (*str) {
-        str++;
+    const char* p = str;
+
+    for (; !is_word_aligned(p); p++) {
+        if (!*p)
+            return p - str;
+    }
+
+    while (!has_zero_byte(load_word(p))) {
+        p += word_size;
     }
-    return str - start;
+
+    while (*p) {
+        p++;
+    }
+
+    return p - str;
+}
+
+extern "C" size_t strnlen(const char* str, size_t maxlen) {
+    size_t len = 0;
+
+    for (; len < maxlen && !is_word_aligned(str + len); len++) {
+        if (!str[len])
+            return len;
+    }
+
+    for (; maxlen - len >= word_size; len += word_size) {
+        if (has_zero_byte(load_word(str + len)))
+            break;
+    }
+
+    for (; len < maxlen; len++) {
+        if (!str[len])
+            return len;
+    }
+
+    return maxlen;
 }
 
 extern "C" int strncmp(const char* str1, const char* str2, size_t n) {
@@ -80,3 +409,93 @@ extern "C" int strncmp(const char* str1, const char* str2, size_t n) {
 
     return 0;
 }
+
+extern "C" char* strchr(const char* str, int c) {
+    char ch = static_cast<char>(c);
+
+    for (; !is_word_aligned(str); str++) {
+        if (*str == ch)
+            return const_cast<char*>(str);
+        if (!*str)
+            return nullptr;
+    }
+
+    Word pattern = repeat_byte(static_cast<unsigned char>(ch));
+    for (;; str += word_size) {
+        Word word = load_word(str);
+        if (has_zero_byte(word) || has_zero_byte(word ^ pattern))
+            break;
+    }
+
+    for (;; str++) {
+        if (*str == ch)
+            return const_cast<char*>(str);
+        if (!*str)
+            return nullptr;
+    }
+}
+
+extern "C" char* strrchr(const char* str, int c) {
+    char ch = static_cast<char>(c);
+
+    if (!ch)
+        return strchr(str, 0);
+
+    const char* last = nullptr;
+    while ((str = strchr(str, ch))) {
+        last = str;
+        str++;
+    }
+
+    return const_cast<char*>(last);
+}
+
+extern "C" char* strcpy(char* dest, const char* src) {
+    char* d = dest;
+
+    for (; !is_word_aligned(src); d++, src++) {
+        if (!(*d = *src))
+            return dest;
+    }
+
+    for (;; d += word_size, src += word_size) {
+        Word word = load_word(src);
+        if (has_zero_byte(word))
+            break;
+        *reinterpret_cast<UnalignedWord*>(d) = word;
+    }
+
+    while ((*d = *src)) {
+        d++, src++;
+    }
+
+    return dest;
+}
+
+extern "C" size_t strlcpy(char* dest, const char* src, size_t size) {
+    size_t len = strlen(src);
+
+    if (size) {
+        size_t count = len < size ? len : size - 1;
+        memcpy(dest, src, count);
+        dest[count] = '\0';
+    }
+
+    return len;
+}
+
+extern "C" char* strstr(const char* haystack, const char* needle) {
+    if (!*needle)
+        return const_cast<char*>(haystack);
+
+    size_t rest = strlen(needle + 1);
+
+    /* strchr() skips ahead a word at a time to each candidate */
+    while ((haystack = strchr(haystack, *needle))) {
+        if (strncmp(haystack + 1, needle + 1, rest) == 0)
+            return const_cast<char*>(haystack);
+        haystack++;
+    }
+
+    return nullptr;
+}
@@ -35,6 +35,7 @@ void* memchr(const void* ptr, int ch, size_t count);
 int memcmp(const void* lhs, const void* rhs, size_t count);
 void* memcpy(void* __restrict dest, const void* __restrict src, size_t count);
 void* memmove(void* dest, const void* src, size_t count);
+void* memrchr(const void* ptr, int ch, size_t count);
 void* memset(void* dest, int ch, size_t count);
 
 char* stpcpy(char* __restrict, const char* __restrict);
@@ -48,6 +49,7 @@ size_t strcspn(const char*, const char*);
 char* strdup(const char*);
 char* strerror(int);
 int strerror_r(int, char*, size_t);
+size_t strlcpy(char* __restrict, const char* __restrict, size_t);
 size_t strlen(const char*);
 char* strncat(char* __restrict, const char* __restrict, size_t);
 int strncmp(const char*, const char*, size_t);
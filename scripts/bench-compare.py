@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+# Compares two CSV files written by `bench --format=csv` and prints the change
+# of the median ns/op for every benchmark present in both files.
+
+import csv
+import sys
+
+
+def load(path: str):
+    with open(path) as file:
+        return {row["name"]: float(row["median_ns"]) for row in csv.DictReader(file)}
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(f"usage: {sys.argv[0]} BEFORE.csv AFTER.csv", file=sys.stderr)
+        exit(1)
+
+    before = load(sys.argv[1])
+    after = load(sys.argv[2])
+
+    print(f"{'benchmark':<40} {'before':>12} {'after':>12} {'change':>9}")
+    for name, old in before.items():
+        if name not in after:
+            continue
+        new = after[name]
+        change = (new - old) / old * 100 if old else 0.0
+        print(f"{name:<40} {old:>12.3f} {new:>12.3f} {change:>+8.1f}%")
+
+
+if __name__ == "__main__":
+    main()